@@ -0,0 +1,44 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Small in-house benchmark harness for the host build (env:bench). Each
+// benchmark runs its body state.iterations times; the runner grows the
+// count until a run takes long enough to time, then reports ns and heap
+// allocations per iteration.
+
+struct BenchState {
+  uint64_t iterations;
+  uint64_t bytesPerIteration;  // optional, for throughput
+  double ratio;                // optional, e.g. encoded / raw size
+};
+
+typedef void (*BenchFn)(BenchState& state);
+
+struct BenchRegistration {
+  BenchRegistration(const char* name, BenchFn fn);
+};
+
+#define BENCH(name)                                                   \
+  static void name(BenchState& state);                                \
+  static BenchRegistration name##Registration(#name, name);           \
+  static void name(BenchState& state)
+
+// Keeps the optimizer from dropping a result
+template <typename T>
+inline void benchKeep(const T& value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Deterministic test content shared by the benchmarks
+void benchMakeBitmap(uint8_t* bitmap, uint32_t seed);
+// Reads a plain (P1) PBM and scales it to the build's bitmap size; exits
+// when the file is missing, since the numbers would mean nothing
+void benchLoadPbm(const char* path, uint8_t* bitmap);
+// Binary CMD_NAV_UPDATE frame with a full bitmap and text; returns its length
+size_t benchMakeNavFrame(uint8_t* buffer, size_t capacity, const uint8_t* bitmap,
+                         const char* title, const char* eta, const char* distance);
+
+#endif
@@ -0,0 +1,167 @@
+#include <string.h>
+#include "app.h"
+#include "bench.h"
+#include "nav_decoder.h"
+#include "nav_protocol.h"
+#include "packbits.h"
+
+#define BENCH_MTU_CHUNK 244  // ATT payload at the 247-byte MTU phones negotiate
+#define BENCH_MIN_CHUNK 20   // default 23-byte MTU
+
+static uint8_t binaryFrames[2][MAX_PAYLOAD + 16];
+static size_t binaryLengths[2];
+static uint8_t legacyFrame[BITMAP_BYTES + 64];
+static size_t legacyLength;
+
+static void prepareFrames() {
+  static bool prepared = false;
+  if (prepared) return;
+  prepared = true;
+
+  uint8_t bitmap[BITMAP_BYTES];
+  for (int i = 0; i < 2; i++) {
+    benchMakeBitmap(bitmap, i);
+    binaryLengths[i] = benchMakeNavFrame(binaryFrames[i], sizeof(binaryFrames[i]), bitmap,
+                                         "Turn left onto Nguyen Van Linh", "12:45", i ? "350 m" : "1.2 km");
+  }
+
+  // Legacy frames cannot carry a ';' in the bitmap
+  for (size_t i = 0; i < BITMAP_BYTES; i++) {
+    if (bitmap[i] == ';') bitmap[i] = 0;
+  }
+  const char* text = ";Turn left onto Nguyen Van Linh|12:45|1.2 km<<<<<";
+  memcpy(legacyFrame, ">>>>>", 5);
+  memcpy(legacyFrame + 5, bitmap, BITMAP_BYTES);
+  memcpy(legacyFrame + 5 + BITMAP_BYTES, text, strlen(text));
+  legacyLength = 5 + BITMAP_BYTES + strlen(text);
+}
+
+static void pushChunked(const uint8_t* data, size_t length, size_t chunk) {
+  for (size_t offset = 0; offset < length; offset += chunk) {
+    processReceivedData(data + offset, length - offset < chunk ? length - offset : chunk);
+  }
+}
+
+BENCH(processReceivedData_binary_mtu244) {
+  prepareFrames();
+  state.bytesPerIteration = binaryLengths[0];
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    pushChunked(binaryFrames[i & 1], binaryLengths[i & 1], BENCH_MTU_CHUNK);
+  }
+}
+
+BENCH(processReceivedData_binary_mtu20) {
+  prepareFrames();
+  state.bytesPerIteration = binaryLengths[0];
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    pushChunked(binaryFrames[i & 1], binaryLengths[i & 1], BENCH_MIN_CHUNK);
+  }
+}
+
+BENCH(processReceivedData_legacy_mtu244) {
+  prepareFrames();
+  state.bytesPerIteration = legacyLength;
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    pushChunked(legacyFrame, legacyLength, BENCH_MTU_CHUNK);
+  }
+}
+
+// The same writes through the BLE callback's queue and the ingest task
+BENCH(appQueueWrite_binary_mtu244) {
+  prepareFrames();
+  state.bytesPerIteration = binaryLengths[0];
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    const uint8_t* data = binaryFrames[i & 1];
+    size_t length = binaryLengths[i & 1];
+    for (size_t offset = 0; offset < length; offset += BENCH_MTU_CHUNK) {
+      appQueueWrite(data + offset, length - offset < BENCH_MTU_CHUNK ? length - offset : BENCH_MTU_CHUNK);
+      appIngest();
+    }
+  }
+}
+
+// A connected session at steady state: writes arrive, the loop renders
+BENCH(steadyState_ingestAndRender) {
+  prepareFrames();
+  appSetConnected(true);
+  state.bytesPerIteration = binaryLengths[0];
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    pushChunked(binaryFrames[i & 1], binaryLengths[i & 1], BENCH_MTU_CHUNK);
+    appLoop();
+  }
+}
+
+// Decoding alone, whole frames at a time, into a frame that is never shown
+class BenchDecodeSink : public NavDecodeSink {
+public:
+  NavFrame& beginFrame() override { return nav_; }
+  void endFrame(NavResult result, uint32_t) override { benchKeep(result); }
+
+private:
+  NavFrame nav_;
+};
+
+BENCH(navDecoder_binary) {
+  prepareFrames();
+  static BenchDecodeSink sink;
+  NavDecoder decoder;
+  state.bytesPerIteration = binaryLengths[0];
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    decoder.push(binaryFrames[0], binaryLengths[0], sink);
+  }
+}
+
+BENCH(navDecoder_legacy) {
+  prepareFrames();
+  static BenchDecodeSink sink;
+  NavDecoder decoder;
+  state.bytesPerIteration = legacyLength;
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    decoder.push(legacyFrame, legacyLength, sink);
+  }
+}
+
+struct EncodedBitmap {
+  uint8_t bitmap[BITMAP_BYTES];
+  uint8_t encoded[BITMAP_BYTES + (BITMAP_BYTES + 127) / 128];
+  size_t length;
+};
+
+static void packBitsDecode(BenchState& state, const EncodedBitmap& e) {
+  static uint8_t decoded[BITMAP_BYTES];
+  state.bytesPerIteration = e.length;
+  state.ratio = (double)e.length / BITMAP_BYTES;
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    PackBitsDecoder decoder(decoded, BITMAP_BYTES);
+    benchKeep(decoder.feed(e.encoded, e.length));
+  }
+}
+
+// Maneuver arrows taken from the device (bench/arrows/), as the app sends
+// them; the ratio is what PackBits saves on the air
+static void packBitsDecodeArrow(BenchState& state, EncodedBitmap& e, const char* path) {
+  if (!e.length) {
+    benchLoadPbm(path, e.bitmap);
+    e.length = packBitsEncode(e.bitmap, BITMAP_BYTES, e.encoded);
+  }
+  packBitsDecode(state, e);
+}
+
+BENCH(packBitsDecode_bitmap) {
+  static EncodedBitmap e;
+  if (!e.length) {
+    benchMakeBitmap(e.bitmap, 0);
+    e.length = packBitsEncode(e.bitmap, BITMAP_BYTES, e.encoded);
+  }
+  packBitsDecode(state, e);
+}
+
+BENCH(packBitsDecode_turnLeft) {
+  static EncodedBitmap e;
+  packBitsDecodeArrow(state, e, "bench/arrows/turn_left.pbm");
+}
+
+BENCH(packBitsDecode_turnRight) {
+  static EncodedBitmap e;
+  packBitsDecodeArrow(state, e, "bench/arrows/turn_right.pbm");
+}
@@ -0,0 +1,325 @@
+// Benchmark runner for env:bench.
+//
+//   program [--filter <text>] [--baseline <file>] [--tolerance <percent>]
+//           [--write-baseline <file>] [--require-no-alloc]
+//
+// With --baseline, exits non-zero when a benchmark is slower than its
+// baseline by more than the tolerance (default 25 %), allocates more or has
+// no baseline entry. Times are compared relative to a calibration loop
+// timed on both hosts, so a baseline written on one machine holds on
+// another. --require-no-alloc fails any benchmark that touches the heap.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+#include "app.h"
+#include "bench.h"
+#include "nav_protocol.h"
+
+#define BENCH_MIN_TIME_NS 200000000ull  // grow iterations until a run takes this long
+
+// Heap allocations, counted through the global operator new
+static std::atomic<uint64_t> allocations(0);
+
+void* operator new(size_t size) {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+  free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+  free(p);
+}
+
+struct Bench {
+  const char* name;
+  BenchFn fn;
+};
+
+struct BenchResult {
+  std::string name;
+  double nsPerOp;
+  double allocsPerOp;
+};
+
+static Bench benches[64];
+static size_t benchCount = 0;
+
+BenchRegistration::BenchRegistration(const char* name, BenchFn fn) {
+  if (benchCount < sizeof(benches) / sizeof(benches[0])) {
+    benches[benchCount].name = name;
+    benches[benchCount].fn = fn;
+    benchCount++;
+  }
+}
+
+void benchMakeBitmap(uint8_t* bitmap, uint32_t seed) {
+  // A thick arrow plus some road lines, roughly what a maneuver icon holds
+  memset(bitmap, 0, BITMAP_BYTES);
+  for (int y = 0; y < BITMAP_HEIGHT; y++) {
+    for (int x = 0; x < BITMAP_WIDTH; x++) {
+      int cx = x - BITMAP_WIDTH / 2;
+      int cy = y - BITMAP_HEIGHT / 3;
+      bool head = cy >= 0 && cy < BITMAP_HEIGHT / 4 && abs(cx) < BITMAP_HEIGHT / 4 - cy;
+      bool shaft = cy >= BITMAP_HEIGHT / 4 && abs(cx) < BITMAP_WIDTH / 12;
+      bool road = (x + y + (int)seed) % 23 < 2;
+      if (head || shaft || road) {
+        uint32_t bit = (uint32_t)y * BITMAP_WIDTH + x;
+        bitmap[bit / 8] |= 0x80 >> (bit % 8);
+      }
+    }
+  }
+}
+
+size_t benchMakeNavFrame(uint8_t* buffer, size_t capacity, const uint8_t* bitmap,
+                         const char* title, const char* eta, const char* distance) {
+  NavFrameWriter writer(buffer, capacity, CMD_NAV_UPDATE);
+  if (bitmap) writer.addField(NAV_TLV_BITMAP, bitmap, BITMAP_BYTES);
+  writer.addField(NAV_TLV_TITLE, title, strlen(title));
+  writer.addField(NAV_TLV_ETA, eta, strlen(eta));
+  writer.addField(NAV_TLV_DISTANCE, distance, strlen(distance));
+  return writer.finish();
+}
+
+// Skips whitespace and comments; false at the end of the file
+static bool skipPbmSpace(FILE* file) {
+  int c;
+  while ((c = fgetc(file)) != EOF) {
+    if (c == '#') {
+      while ((c = fgetc(file)) != EOF && c != '\n') {}
+    } else if (c > ' ') {
+      ungetc(c, file);
+      return true;
+    }
+  }
+  return false;
+}
+
+static int readPbmNumber(FILE* file) {
+  int value;
+  return skipPbmSpace(file) && fscanf(file, "%d", &value) == 1 ? value : -1;
+}
+
+void benchLoadPbm(const char* path, uint8_t* bitmap) {
+  FILE* file = fopen(path, "r");
+  int width = -1;
+  int height = -1;
+  if (file && fgetc(file) == 'P' && fgetc(file) == '1') {
+    width = readPbmNumber(file);
+    height = readPbmNumber(file);
+  }
+  std::vector<uint8_t> pixels;
+  for (int i = 0; width > 0 && height > 0 && i < width * height; i++) {
+    // Pixels are single digits, with or without spaces between them
+    int c = skipPbmSpace(file) ? fgetc(file) : EOF;
+    if (c != '0' && c != '1') break;
+    pixels.push_back(c == '1');
+  }
+  if (file) fclose(file);
+  if (width <= 0 || height <= 0 || pixels.size() != (size_t)(width * height)) {
+    fprintf(stderr, "cannot read %s (run from the project root)\n", path);
+    exit(2);
+  }
+  // Nearest neighbour, so a corpus drawn for one display serves both
+  memset(bitmap, 0, BITMAP_BYTES);
+  for (int y = 0; y < BITMAP_HEIGHT; y++) {
+    for (int x = 0; x < BITMAP_WIDTH; x++) {
+      if (!pixels[(y * height / BITMAP_HEIGHT) * width + x * width / BITMAP_WIDTH]) continue;
+      uint32_t bit = (uint32_t)y * BITMAP_WIDTH + x;
+      bitmap[bit / 8] |= 0x80 >> (bit % 8);
+    }
+  }
+}
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Fixed integer and memory work, timed with every run; the baseline's
+// times are scaled by how much faster or slower it is on this host
+static void calibrate(BenchState& state) {
+  static uint32_t table[4096];
+  uint32_t x = 1;
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    for (uint32_t j = 0; j < 256; j++) {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      table[x % 4096] += j;
+    }
+  }
+  benchKeep(table[x % 4096]);
+}
+
+static BenchResult run(const Bench& bench) {
+  BenchState state = {1, 0, 0};
+  bench.fn(state);  // warm up caches and lazy state
+
+  for (;;) {
+    uint64_t allocsBefore = allocations.load();
+    uint64_t start = nowNs();
+    bench.fn(state);
+    uint64_t elapsed = nowNs() - start;
+    uint64_t allocs = allocations.load() - allocsBefore;
+    if (elapsed >= BENCH_MIN_TIME_NS || state.iterations >= (1ull << 32)) {
+      BenchResult result;
+      result.name = bench.name;
+      result.nsPerOp = (double)elapsed / state.iterations;
+      result.allocsPerOp = (double)allocs / state.iterations;
+      printf("%-32s %12.1f ns/op %8.2f allocs/op", bench.name, result.nsPerOp, result.allocsPerOp);
+      if (state.bytesPerIteration) {
+        printf(" %9.2f MB/s", state.bytesPerIteration * 1e3 / result.nsPerOp);
+      }
+      if (state.ratio) {
+        printf(" ratio %.3f", state.ratio);
+      }
+      printf("\n");
+      return result;
+    }
+    uint64_t next = elapsed ? state.iterations * BENCH_MIN_TIME_NS * 12 / 10 / elapsed : state.iterations * 100;
+    state.iterations = next > state.iterations ? next : state.iterations * 2;
+  }
+}
+
+static bool readBaseline(const char* path, std::vector<BenchResult>& baseline) {
+  FILE* file = fopen(path, "r");
+  if (!file) return false;
+  char line[256];
+  char name[128];
+  double ns, allocs;
+  while (fgets(line, sizeof(line), file)) {
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%127s %lf %lf", name, &ns, &allocs) != 3) continue;
+    BenchResult entry = {name, ns, allocs};
+    baseline.push_back(entry);
+  }
+  fclose(file);
+  return true;
+}
+
+// CPU model for the baseline header, where the OS tells
+static std::string hostName() {
+  FILE* file = fopen("/proc/cpuinfo", "r");
+  char line[256];
+  std::string model = "unknown CPU";
+  while (file && fgets(line, sizeof(line), file)) {
+    const char* colon = strchr(line, ':');
+    if (strncmp(line, "model name", 10) != 0 || !colon) continue;
+    model = colon + 2;
+    model.erase(model.find_last_not_of("\r\n") + 1);
+    break;
+  }
+  if (file) fclose(file);
+  return model;
+}
+
+static bool writeBaseline(const char* path, const BenchResult& calibration, const std::vector<BenchResult>& results) {
+  FILE* file = fopen(path, "w");
+  if (!file) return false;
+  fprintf(file, "# %s, compiler %s\n", hostName().c_str(), __VERSION__);
+  fprintf(file, "# name ns/op allocs/op; ns are compared scaled by the calibration entry\n");
+  fprintf(file, "%s %.1f %.2f\n", calibration.name.c_str(), calibration.nsPerOp, calibration.allocsPerOp);
+  for (const BenchResult& r : results) fprintf(file, "%s %.1f %.2f\n", r.name.c_str(), r.nsPerOp, r.allocsPerOp);
+  fclose(file);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const char* filter = nullptr;
+  const char* baselinePath = nullptr;
+  const char* writePath = nullptr;
+  double tolerance = 25.0;
+  bool requireNoAlloc = false;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+      baselinePath = argv[++i];
+    } else if (strcmp(argv[i], "--write-baseline") == 0 && i + 1 < argc) {
+      writePath = argv[++i];
+    } else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc) {
+      tolerance = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--require-no-alloc") == 0) {
+      requireNoAlloc = true;
+    } else {
+      fprintf(stderr, "usage: %s [--filter text] [--baseline file] [--tolerance percent] [--write-baseline file]"
+                      " [--require-no-alloc]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  std::vector<BenchResult> baseline;
+  if (baselinePath && !readBaseline(baselinePath, baseline)) {
+    fprintf(stderr, "cannot read baseline %s\n", baselinePath);
+    return 2;
+  }
+
+  appSetup();
+  static const Bench calibrationBench = {"calibration", calibrate};
+  BenchResult calibration = run(calibrationBench);
+  double scale = 1.0;
+  for (const BenchResult& b : baseline) {
+    if (b.name == calibration.name) scale = calibration.nsPerOp / b.nsPerOp;
+  }
+  if (baselinePath) printf("baseline scaled by %.2f for this host\n", scale);
+  std::vector<BenchResult> results;
+  for (size_t i = 0; i < benchCount; i++) {
+    if (filter && !strstr(benches[i].name, filter)) continue;
+    results.push_back(run(benches[i]));
+  }
+
+  if (writePath && !writeBaseline(writePath, calibration, results)) {
+    fprintf(stderr, "cannot write baseline %s\n", writePath);
+    return 2;
+  }
+
+  int regressions = 0;
+  for (const BenchResult& r : results) {
+    if (requireNoAlloc && r.allocsPerOp > 0) {
+      printf("ALLOCATES %s: %.2f allocs/op\n", r.name.c_str(), r.allocsPerOp);
+      regressions++;
+    }
+    bool found = false;
+    for (const BenchResult& b : baseline) {
+      if (b.name != r.name) continue;
+      found = true;
+      double expected = b.nsPerOp * scale;
+      bool slower = r.nsPerOp > expected * (1.0 + tolerance / 100.0);
+      bool allocates = r.allocsPerOp > b.allocsPerOp + 0.005;
+      if (slower || allocates) {
+        printf("REGRESSION %s: %.1f ns/op (baseline %.1f), %.2f allocs/op (baseline %.2f)\n", r.name.c_str(),
+               r.nsPerOp, expected, r.allocsPerOp, b.allocsPerOp);
+        regressions++;
+      }
+    }
+    // A benchmark nobody recorded would go unchecked; rewrite the baseline
+    if (baselinePath && !found) {
+      printf("NO BASELINE %s\n", r.name.c_str());
+      regressions++;
+    }
+  }
+  return regressions ? 1 : 0;
+}
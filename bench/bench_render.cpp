@@ -0,0 +1,257 @@
+#include <string.h>
+#include "bench.h"
+#include "bitmap_blit.h"
+#include "display.h"
+#include "glyph_cache.h"
+#include "hal.h"
+#include "myfont.h"
+#include "text_layout.h"
+
+extern const uint8_t u8g2_font_unifont_t_vietnamese1[];
+extern const uint8_t u8g2_font_helvB18_tf[];
+extern const uint8_t u8g2_font_inr33_mf[];
+
+static const uint8_t* benchBitmap() {
+  static uint8_t bitmap[BITMAP_BYTES];
+  static bool made = false;
+  if (!made) {
+    benchMakeBitmap(bitmap, 0);
+    made = true;
+  }
+  return bitmap;
+}
+
+BENCH(drawBitmap) {
+  const uint8_t* bitmap = benchBitmap();
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    drawBitmap((SCREEN_WIDTH - BITMAP_WIDTH) / 2, 2, bitmap, BITMAP_WIDTH, BITMAP_HEIGHT);
+  }
+}
+
+// The runtime-sized blitters vs. the ones fixed at BITMAP_WIDTH x
+// BITMAP_HEIGHT, into plain buffers so both displays can run them
+static uint8_t benchPages[SCREEN_WIDTH * ((SCREEN_HEIGHT + 7) / 8)];
+static uint16_t benchLines[8 * BITMAP_WIDTH];
+
+BENCH(blitToPages_runtime) {
+  const uint8_t* bitmap = benchBitmap();
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    blitToPages(benchPages, SCREEN_WIDTH, SCREEN_HEIGHT, 2, 3, bitmap, BITMAP_WIDTH, BITMAP_HEIGHT);
+  }
+  benchKeep(benchPages[SCREEN_WIDTH + 10]);
+}
+
+BENCH(blitToPages_fixed) {
+  const uint8_t* bitmap = benchBitmap();
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    blitPagesFixed<BITMAP_WIDTH, BITMAP_HEIGHT, 1>(benchPages, SCREEN_WIDTH, SCREEN_HEIGHT, 2, 3, bitmap);
+  }
+  benchKeep(benchPages[SCREEN_WIDTH + 10]);
+}
+
+BENCH(expandBits565_runtime) {
+  const uint8_t* bitmap = benchBitmap();
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    for (int16_t row = 0; row + 8 <= BITMAP_HEIGHT; row += 8) {
+      expandBits565(bitmap, (uint32_t)row * BITMAP_WIDTH, 8 * BITMAP_WIDTH, benchLines, 0xFFFF, 0);
+    }
+  }
+  benchKeep(benchLines[BITMAP_WIDTH + 3]);
+}
+
+BENCH(expandBits565_fixed) {
+  const uint8_t* bitmap = benchBitmap();
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    for (int16_t row = 0; row + 8 <= BITMAP_HEIGHT; row += 8) {
+      expandLines565Fixed<BITMAP_WIDTH, 1>(bitmap, row, 8, benchLines, 0xFFFF, 0);
+    }
+  }
+  benchKeep(benchLines[BITMAP_WIDTH + 3]);
+}
+
+#ifdef USE_OLED_GME128128
+// A 32x32 corner of the icon, so 3x still fits the panel
+static const uint8_t* benchIcon() {
+  static uint8_t icon[32 * 32 / 8];
+  const uint8_t* bitmap = benchBitmap();
+  for (int y = 0; y < 32; y++) {
+    for (int x = 0; x < 32; x++) {
+      uint32_t bit = (uint32_t)(y + BITMAP_HEIGHT / 3) * BITMAP_WIDTH + x + BITMAP_WIDTH / 3;
+      if (bitmap[bit / 8] & (0x80 >> (bit % 8))) icon[y * 4 + x / 8] |= 0x80 >> (x % 8);
+    }
+  }
+  return icon;
+}
+
+static void benchScaled(BenchState& state, int scale) {
+  const uint8_t* icon = benchIcon();
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    drawBitmapScaled(halOled(), 0, 0, icon, 32, 32, scale);
+  }
+}
+
+template <uint8_t Scale>
+static void benchScaledFixed(BenchState& state) {
+  const uint8_t* icon = benchIcon();
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    drawBitmapScaled<32, 32, Scale>(halOled(), 0, 0, icon);
+  }
+}
+
+BENCH(drawBitmapScaled_x1) {
+  benchScaled(state, 1);
+}
+
+BENCH(drawBitmapScaled_x2) {
+  benchScaled(state, 2);
+}
+
+BENCH(drawBitmapScaled_x3) {
+  benchScaled(state, 3);
+}
+
+BENCH(drawBitmapScaled_fixed_x1) {
+  benchScaledFixed<1>(state);
+}
+
+BENCH(drawBitmapScaled_fixed_x2) {
+  benchScaledFixed<2>(state);
+}
+
+BENCH(drawBitmapScaled_fixed_x3) {
+  benchScaledFixed<3>(state);
+}
+#endif
+
+// drawUnicodeString at the three text sizes the layouts use
+BENCH(drawUnicodeString_small) {
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    drawUnicodeString(0, 124, "Rẽ trái vào Nguyễn", 1, u8g2_font_unifont_t_vietnamese1);
+  }
+}
+
+BENCH(drawUnicodeString_medium) {
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    drawUnicodeString(20, 102, "1.2 km", 1, u8g2_font_helvB18_tf);
+  }
+}
+
+BENCH(drawUnicodeString_large) {
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    drawUnicodeString(0, 60, "350 m", 1, u8g2_font_inr33_mf);
+  }
+}
+
+BENCH(drawUnicodeString_wrapped) {
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    drawUnicodeString(0, 124, "Tiếp tục đi thẳng vào Đại lộ Võ Văn Kiệt rồi rẽ phải vào Nguyễn Văn Linh", 1,
+                      u8g2_font_unifont_t_vietnamese1);
+  }
+}
+
+// Wrapping the title from scratch vs. finding it in the layout cache. Only
+// glyph metrics are needed, so a u8g2 without a display will do.
+static u8g2_t benchText;
+static const char* benchLongTitle = "Tiếp tục đi thẳng vào Đại lộ Võ Văn Kiệt rồi rẽ phải vào Nguyễn Văn Linh";
+
+BENCH(layoutText_title) {
+  static TextLayout layout;
+  u8g2_SetFont(&benchText, u8g2_font_unifont_t_vietnamese1);
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    layoutText(&benchText, benchLongTitle, SCREEN_WIDTH, layout);
+    benchKeep(layout.lineCount);
+  }
+}
+
+BENCH(layoutText_cached) {
+  static TextLayoutCache cache;
+  u8g2_SetFont(&benchText, u8g2_font_unifont_t_vietnamese1);
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    benchKeep(cache.get(&benchText, benchLongTitle, SCREEN_WIDTH).lineCount);
+  }
+}
+
+// Street names through u8g2's font decoder vs. the glyph cache, in the
+// TFT title font
+static const char* const benchStreets[] = {
+  "Nguyễn Văn Linh", "Đại lộ Võ Văn Kiệt", "Điện Biên Phủ", "Trần Hưng Đạo",
+  "Cách Mạng Tháng Tám", "Phạm Văn Đồng", "Xa lộ Hà Nội", "Huỳnh Tấn Phát",
+};
+#define BENCH_STREETS (sizeof(benchStreets) / sizeof(benchStreets[0]))
+
+BENCH(textWidth_u8g2) {
+  u8g2_SetFont(&benchText, myfont);
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    benchKeep(u8g2_GetUTF8Width(&benchText, benchStreets[i % BENCH_STREETS]));
+  }
+}
+
+BENCH(textWidth_glyphCache) {
+  u8g2_SetFont(&benchText, myfont);
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    benchKeep(glyphStringWidth(&benchText, benchStreets[i % BENCH_STREETS]));
+  }
+}
+
+#ifdef USE_OLED_GME128128
+BENCH(drawText_u8g2) {
+  u8g2_SetFont(halOled(), myfont);
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    benchKeep(u8g2_DrawUTF8(halOled(), 0, 100, benchStreets[i % BENCH_STREETS]));
+  }
+}
+
+BENCH(drawText_glyphCache) {
+  u8g2_SetFont(halOled(), myfont);
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    benchKeep(drawGlyphString(halOled(), 0, 100, benchStreets[i % BENCH_STREETS]));
+  }
+}
+#endif
+
+static void makeNav(NavFrame& nav, uint32_t seed, const char* distance) {
+  benchMakeBitmap(nav.bitmap, seed);
+  nav.hasBitmap = true;
+  nav.title = "Turn left onto Nguyen Van Linh";
+  nav.eta = "12:45";
+  nav.distance = distance;
+}
+
+BENCH(updateDisplay_newManeuver) {
+  static NavFrame navs[2];
+  makeNav(navs[0], 0, "1.2 km");
+  makeNav(navs[1], 1, "350 m");
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    updateDisplay(navs[i & 1], true);
+  }
+}
+
+BENCH(updateDisplay_distanceOnly) {
+  static NavFrame navs[2];
+  makeNav(navs[0], 0, "1.2 km");
+  makeNav(navs[1], 0, "1.1 km");
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    updateDisplay(navs[i & 1], true);
+  }
+}
+
+BENCH(updateDisplay_unchanged) {
+  static NavFrame nav;
+  makeNav(nav, 0, "1.2 km");
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    updateDisplay(nav, true);
+  }
+}
+
+#ifdef USE_OLED_GME128128
+// One marquee step of a title too wide for the panel
+BENCH(updateDisplay_marqueeTick) {
+  static NavFrame nav;
+  makeNav(nav, 0, "1.2 km");
+  nav.title = benchLongTitle;
+  for (uint64_t i = 0; i < state.iterations; i++) {
+    displayScrollTick();
+    updateDisplay(nav, true);
+  }
+}
+#endif
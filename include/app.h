@@ -0,0 +1,51 @@
+#ifndef APP_H
+#define APP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Ingest and render logic, shared by the firmware and the host build.
+// Hardware access goes through hal.h.
+
+// Display and caches; BLE is brought up by the caller
+void appSetup();
+// BLE callback: queues one write to the data characteristic for the ingest
+// task and wakes it; false if the queue was full and the write was dropped
+bool appQueueWrite(const uint8_t* data, size_t length);
+// BLE callback: queues one chunk from the transfer characteristic
+// (transfer_receiver.h); false if it was dropped, which the sender learns
+// from the next ACK
+bool appQueueTransfer(const uint8_t* data, size_t length);
+// Ingest task body: decodes every queued write and sends the
+// transfer ACK that is due
+void appIngest();
+// Ingest task: one write, decoded right away
+void processReceivedData(const uint8_t* data, size_t length);
+void appSetConnected(bool connected);
+// BLE task: the MTU, PHY or connection parameters changed, or the status
+// characteristic got a subscriber; the render task reads the link back and
+// reports it
+void appLinkChanged();
+// BLE task: a connection parameter / PHY update procedure finished; `ok`
+// when the peer took the parameters, `on2M` when the link runs on 2M PHY.
+// Both imply appLinkChanged().
+void appLinkParamsUpdated(bool ok);
+void appLinkPhyUpdated(bool on2M);
+// Render task body; true when it drew a new frame
+bool appLoop();
+// How long the render task may sleep before appLoop() has work, in ms.
+// halRenderWake() cuts the sleep short when a frame or event arrives.
+#define APP_WAIT_FOREVER 0xFFFFFFFFu
+uint32_t appNextWakeMs();
+
+#ifdef ENABLE_PIPELINE_STATS
+// CMD_PIPELINE_STATS frame for the status characteristic
+size_t appStatsFrame(uint8_t* buffer, size_t capacity);
+#endif
+// Serial console: frame, glyph cache, ingest, transfer and link counters,
+// followed by the stage table with ENABLE_PIPELINE_STATS
+void appDumpStats();
+void appResetStats();
+
+#endif
@@ -0,0 +1,159 @@
+#ifndef BITMAP_BLIT_H
+#define BITMAP_BLIT_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Direct blitters for packed 1-bpp bitmaps: MSB first, rows not padded, the
+// format the app sends and config.h describes.
+
+// ORs the set pixels of `bitmap` into a U8g2 full frame buffer laid out in
+// vertical pages (one byte = 8 rows of one column, LSB on top), as used by
+// the SH1107. Works on 8x8 blocks: eight source bytes are transposed into
+// eight page bytes at once, and empty blocks are skipped. Clips to the buffer.
+void blitToPages(uint8_t* buffer, int16_t bufferWidth, int16_t bufferHeight,
+                 int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h);
+
+// Expands `count` pixels starting at bit `bitPos` of a packed bitmap into
+// RGB565, a byte of source at a time, for streaming into a TFT window.
+void expandBits565(const uint8_t* bitmap, uint32_t bitPos, uint32_t count,
+                   uint16_t* dst, uint16_t fg, uint16_t bg);
+
+// 8x8 bit matrix transpose (Hacker's Delight 7-3). rows[0] is the top row
+// with column 0 in the MSB; cols[c] receives column c with row 0 in the LSB.
+inline void transpose8(const uint8_t rows[8], uint8_t cols[8]) {
+  uint32_t x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) | ((uint32_t)rows[5] << 8) | rows[4];
+  uint32_t y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) | ((uint32_t)rows[1] << 8) | rows[0];
+  uint32_t t;
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+  cols[0] = x >> 24; cols[1] = x >> 16; cols[2] = x >> 8; cols[3] = x;
+  cols[4] = y >> 24; cols[5] = y >> 16; cols[6] = y >> 8; cols[7] = y;
+}
+
+// Fixed-size blitters: the same two jobs with the bitmap size and scale as
+// template parameters. Bitmaps have one size per build (BITMAP_WIDTH x
+// BITMAP_HEIGHT), so every row offset, shift and edge mask becomes a
+// constant. Scaling goes through bitSpread a byte at a time, and nothing
+// branches or divides per pixel.
+
+#define BLIT_MAX_SCALE 3
+
+// bitSpread[s - 1][v]: bit i of v repeated s times, starting at bit i * s
+extern const uint32_t bitSpread[BLIT_MAX_SCALE][256];
+
+// Eight pixels of row K of an 8-row group, from byte column `col`; only
+// the top `Cols` bits are used
+template <int16_t W, int K, int Cols>
+inline uint8_t fixedRowBits(const uint8_t* group, int16_t col) {
+  const uint8_t* p = group + (K * W) / 8 + col;
+  const int shift = (K * W) % 8;
+  uint8_t bits = p[0] << shift;
+  if (shift && shift + Cols > 8) bits |= p[1] >> (8 - shift);
+  return bits & (uint8_t)(0xFF << (8 - Cols));
+}
+
+// ORs one 8x8 source block, scaled, into the page buffer at (x, page * 8 + shift)
+template <int16_t W, int Rows, int Cols, uint8_t Scale>
+inline void blitPagesBlock(uint8_t* buffer, int16_t bufferWidth, int16_t pages,
+                           int16_t x, int16_t page, uint8_t shift, const uint8_t* group, int16_t col) {
+  uint8_t rows[8];
+  rows[0] = fixedRowBits<W, 0, Cols>(group, col);
+  rows[1] = Rows > 1 ? fixedRowBits<W, 1, Cols>(group, col) : 0;
+  rows[2] = Rows > 2 ? fixedRowBits<W, 2, Cols>(group, col) : 0;
+  rows[3] = Rows > 3 ? fixedRowBits<W, 3, Cols>(group, col) : 0;
+  rows[4] = Rows > 4 ? fixedRowBits<W, 4, Cols>(group, col) : 0;
+  rows[5] = Rows > 5 ? fixedRowBits<W, 5, Cols>(group, col) : 0;
+  rows[6] = Rows > 6 ? fixedRowBits<W, 6, Cols>(group, col) : 0;
+  rows[7] = Rows > 7 ? fixedRowBits<W, 7, Cols>(group, col) : 0;
+  if (!(rows[0] | rows[1] | rows[2] | rows[3] | rows[4] | rows[5] | rows[6] | rows[7])) return;
+
+  uint8_t cols[8];
+  transpose8(rows, cols);
+  // Pages a shifted, scaled column can touch, clipped to the buffer
+  const int16_t first = page < 0 ? -page : 0;
+  const int16_t last = page + Scale + 1 > pages ? pages - page : Scale + 1;
+  for (int b = 0; b < Cols; b++) {
+    const uint32_t column = bitSpread[Scale - 1][cols[b]] << shift;
+    if (!column) continue;
+    for (int s = 0; s < Scale; s++) {
+      const int16_t dx = x + (col * 8 + b) * Scale + s;
+      if (dx < 0 || dx >= bufferWidth) continue;
+      uint8_t* dst = buffer + page * bufferWidth + dx;
+      for (int16_t q = first; q < last; q++) dst[q * bufferWidth] |= (uint8_t)(column >> (8 * q));
+    }
+  }
+}
+
+template <int16_t W, int Rows, uint8_t Scale>
+inline void blitPagesGroup(uint8_t* buffer, int16_t bufferWidth, int16_t pages,
+                           int16_t x, int16_t dy, const uint8_t* group) {
+  const int16_t page = dy >= 0 ? dy / 8 : -((7 - dy) / 8);
+  const uint8_t shift = dy - page * 8;
+  if (page + Scale < 0 || page >= pages) return;
+  for (int16_t col = 0; col < W / 8; col++) {
+    blitPagesBlock<W, Rows, 8, Scale>(buffer, bufferWidth, pages, x, page, shift, group, col);
+  }
+  if (W % 8) blitPagesBlock<W, Rows, W % 8, Scale>(buffer, bufferWidth, pages, x, page, shift, group, W / 8);
+}
+
+// blitToPages for a W x H bitmap, drawn `Scale` times as large
+template <int16_t W, int16_t H, uint8_t Scale>
+void blitPagesFixed(uint8_t* buffer, int16_t bufferWidth, int16_t bufferHeight,
+                    int16_t x, int16_t y, const uint8_t* bitmap) {
+  static_assert(Scale >= 1 && Scale <= BLIT_MAX_SCALE, "unsupported scale");
+  const int16_t pages = (bufferHeight + 7) / 8;
+  // Eight rows of W bits are W whole bytes, so every group starts on a byte
+  for (int16_t r0 = 0; r0 < H - H % 8; r0 += 8) {
+    blitPagesGroup<W, 8, Scale>(buffer, bufferWidth, pages, x, y + r0 * Scale, bitmap + r0 / 8 * W);
+  }
+  if (H % 8) blitPagesGroup<W, H % 8, Scale>(buffer, bufferWidth, pages, x, y + (H - H % 8) * Scale,
+                                             bitmap + H / 8 * W);
+}
+
+// The top `Bits` pixels of `bits` in RGB565, each repeated `Scale` times
+template <int Bits, uint8_t Scale>
+inline uint16_t* expandByte565(uint8_t bits, uint16_t* dst, uint16_t fg, uint16_t bg) {
+  const uint16_t diff = fg ^ bg;
+#pragma GCC unroll 8
+  for (int b = 0; b < Bits; b++) {
+    const uint16_t pixel = bg ^ (diff & (uint16_t)-((bits >> (7 - b)) & 1));
+    for (int s = 0; s < Scale; s++) *dst++ = pixel;
+  }
+  return dst;
+}
+
+// expandBits565 for `count` whole rows of a W-wide bitmap from `row` on,
+// each `Scale` times as wide and as tall: count * Scale lines of W * Scale
+template <int16_t W, uint8_t Scale>
+void expandLines565Fixed(const uint8_t* bitmap, int16_t row, int16_t count,
+                         uint16_t* dst, uint16_t fg, uint16_t bg) {
+  static_assert(Scale >= 1, "unsupported scale");
+  for (int16_t r = row; r < row + count; r++) {
+    const uint32_t bit = (uint32_t)r * W;
+    const uint8_t* p = bitmap + bit / 8;
+    const uint8_t shift = bit % 8;
+    uint16_t* line = dst;
+    for (int16_t i = 0; i < W / 8; i++) {
+      uint8_t bits = p[i] << shift;
+      if (shift) bits |= p[i + 1] >> (8 - shift);
+      dst = expandByte565<8, Scale>(bits, dst, fg, bg);
+    }
+    if (W % 8) {
+      uint8_t bits = p[W / 8] << shift;
+      if (shift + W % 8 > 8) bits |= p[W / 8 + 1] >> (8 - shift);
+      dst = expandByte565<W % 8, Scale>(bits, dst, fg, bg);
+    }
+    for (int s = 1; s < Scale; s++) {
+      memcpy(dst, line, W * Scale * sizeof(uint16_t));
+      dst += W * Scale;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <stdint.h>
+
+struct Rect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+
+  bool empty() const { return w <= 0 || h <= 0; }
+  bool intersects(const Rect& other) const {
+    return !empty() && !other.empty() && x < other.x + other.w && other.x < x + w &&
+           y < other.y + other.h && other.y < y + h;
+  }
+  void unite(const Rect& other);
+};
+
+// Retained-mode bookkeeping for a screen made of up to eight fixed widgets,
+// indexed in draw order. Callers mark the widgets whose content changed;
+// resolve() adds every widget a repaint would disturb, and damage() covers
+// all of them: a repainted neighbour may come out different from what the
+// panel shows, e.g. when its clear or draw order changed.
+class Compositor {
+public:
+  // Opaque widgets paint every pixel of their rect, so they need no clear
+  // and hide whatever lies below them.
+  Compositor(const Rect* rects, uint8_t count, uint8_t opaqueMask = 0)
+      : rects_(rects), count_(count), opaque_(opaqueMask), changed_(0) {}
+
+  void invalidate(uint8_t widget) { changed_ |= 1u << widget; }
+  void invalidateAll() { changed_ = (1u << count_) - 1; }
+  bool pending() const { return changed_ != 0; }
+  void clear() { changed_ = 0; }
+
+  // Bit mask of widgets to clear and repaint in index order.
+  uint8_t resolve() const;
+  // Bounding box of the widgets resolve() repaints.
+  Rect damage() const;
+
+  const Rect& rect(uint8_t widget) const { return rects_[widget]; }
+  bool isOpaque(uint8_t widget) const { return opaque_ & (1u << widget); }
+
+private:
+  const Rect* rects_;
+  uint8_t count_;
+  uint8_t opaque_;
+  uint8_t changed_;
+};
+
+#endif
@@ -11,6 +11,7 @@
     #define BITMAP_WIDTH 132
     #define BITMAP_HEIGHT 132
     #define STATUS_BAR_HEIGHT 36
+    #define SCROLL_FPS 30
 
     // TFT Pins
     #define TFT_CS    5
@@ -28,15 +29,93 @@
     #define BITMAP_WIDTH 90
     #define BITMAP_HEIGHT 90
     #define STATUS_BAR_HEIGHT 16
+    #define SCROLL_FPS 30       // marquee frame rate; each frame flushes the title pages over I2C
 #endif
 
+// Bitmaps are packed MSB-first with no per-row padding
+#define BITMAP_BYTES ((BITMAP_WIDTH * BITMAP_HEIGHT + 7) / 8)
+
 #define LINE_SPACING_OFFSET 5
 
 // BLE Data Frame Configuration
 #define FRAME_HEADER    0xAA
+#define PROTOCOL_VERSION 0x01
 #define CMD_NAV_UPDATE  0x01
-#define MAX_PAYLOAD     32
+#define MAX_PAYLOAD     (BITMAP_BYTES + 512)  // bitmap plus text fields
+
+// Device -> app frames on the status characteristic
+#define CMD_ICON_NACK   0x81
+#define CMD_PIPELINE_STATS 0x82
+#define CMD_LINK_STATUS 0x83
+
+// Maneuver icon cache (decoded bitmaps kept in RAM, LRU)
+#define ICON_CACHE_ENTRIES 8
+// #define ICON_CACHE_PERSIST   // also keep icons in NVS across reboots
 
+// Decoded font glyphs kept in RAM (LRU), about 150 bytes each; at most 255
+#define GLYPH_CACHE_ENTRIES 64
+
+// Stream TFT bitmaps through one address window, TFT_BURST_LINES lines per
+// SPI burst, instead of one transaction per run of pixels
 #define USE_SPI_DMA
+#define TFT_BURST_LINES 8
+
+// Task layout. BLE writes are queued for the ingest task, which decodes
+// frames and hands them to the render task, so a long blit never
+// holds up the BLE callbacks. A dual-core ESP32 runs ingest on core 0 next
+// to the BLE host and rendering on core 1. The single-core ESP32-C3 runs
+// both on core 0; ingest's higher priority lets it preempt a render.
+#define INGEST_TASK_CORE      0
+#define INGEST_TASK_PRIORITY  3
+#define INGEST_TASK_STACK     6144
+#define RENDER_TASK_CORE      1
+#define RENDER_TASK_PRIORITY  1
+#define RENDER_TASK_STACK     8192
+#define INGEST_QUEUE_WRITES   8    // writes buffered ahead of the ingest task; a power of two
+#define INGEST_WRITE_MAX      512  // bytes per queue slot; the ATT maximum
+
+// The render task only ever draws the newest complete frame; frames that a
+// newer one replaced before it got to them are counted as coalesced. With
+// SKIP_UNCHANGED_FRAMES a frame whose content hash matches the one on
+// screen costs a compare instead of a redraw and flush.
+#define SKIP_UNCHANGED_FRAMES
+
+// Flow-controlled transfer characteristic (transfer_receiver.h). The phone
+// numbers its chunks and keeps at most TRANSFER_WINDOW of them past the last
+// cumulative ACK, so the ingest queue can always take them; a lost chunk is
+// the only one sent again. Window and queue slots hold INGEST_WRITE_MAX
+// bytes each; a smaller window saves RAM but keeps fewer chunks in flight.
+#define TRANSFER_WINDOW       8    // a power of two, at most 16 and INGEST_QUEUE_WRITES
+#define TRANSFER_ACK_EVERY    4    // in-order chunks between ACKs nobody asked for
+
+// BLE link (link_tuner.h). The largest MTU lets a write carry 512 bytes,
+// so a bitmap frame takes a handful of writes instead of dozens. While
+// frames stream the link asks for 2M PHY and a 15-30 ms interval; after
+// LINK_IDLE_MS without writes it relaxes to 100-125 ms with slave latency.
+// Both sets stay inside Apple's accessory guidelines (minimum interval
+// 15 ms, max - min >= 15 ms, timeout 2-6 s). Intervals are in 1.25 ms
+// units, the supervision timeout in 10 ms units.
+#define LINK_MTU                   517
+#define LINK_FAST_MIN_INTERVAL     12
+#define LINK_FAST_MAX_INTERVAL     24
+#define LINK_FAST_LATENCY          0
+#define LINK_RELAXED_MIN_INTERVAL  80
+#define LINK_RELAXED_MAX_INTERVAL  100
+#define LINK_RELAXED_LATENCY       4
+#define LINK_TIMEOUT               400
+#define LINK_IDLE_MS               5000
+#define LINK_RETRY_MS              500  // after the stack refused to start a request
+#define LINK_PHY_RETRY_MS          2000 // before asking for 2M PHY a second time
+#define LINK_PHY_ATTEMPTS          2
+
+// Per-stage latency histograms, readable on the status characteristic and
+// dumped on Serial along with the counters ('s' dumps, 'r' resets). Comment
+// out to compile them away; the counters stay.
+#define ENABLE_PIPELINE_STATS
+#define PIPELINE_STATS_NOTIFY_MS 5000
+
+// Log every data write and connection event on Serial as "TRACE <hex>" lines
+// for replay on the host (tools/trace_extract.py). Slows ingest down.
+// #define ENABLE_BLE_TRACE
 
 #endif
\ No newline at end of file
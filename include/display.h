@@ -0,0 +1,32 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <stdint.h>
+#include "nav_frame.h"
+
+// Screen rendering on top of the HAL display primitives.
+
+void displayBegin();
+// Repaints whatever differs between `nav` and the screen
+void updateDisplay(const NavFrame& nav, bool connected);
+
+// The title marquee needs a repaint every tick while it scrolls
+bool displayScrolling();
+void displayScrollTick();
+
+void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h);
+#ifdef USE_OLED_GME128128
+#include <clib/u8g2.h>
+void drawBitmapScaled(u8g2_t* u8g2, int x, int y, const uint8_t *bitmap, int width, int height, int scale);
+#include "bitmap_blit.h"
+// Same for a size and scale known at compile time, straight into the page
+// buffer; set pixels are ORed in, ignoring the draw color and clip window
+template <int16_t W, int16_t H, uint8_t Scale>
+void drawBitmapScaled(u8g2_t* u8g2, int16_t x, int16_t y, const uint8_t* bitmap) {
+  blitPagesFixed<W, H, Scale>(u8g2_GetBufferPtr(u8g2), u8g2_GetBufferTileWidth(u8g2) * 8,
+                              u8g2_GetBufferTileHeight(u8g2) * 8, x, y, bitmap);
+}
+#endif
+void drawUnicodeString(int16_t x, int16_t y, const char* text, uint16_t color, const uint8_t* font);
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef FIXED_STRING_H
+#define FIXED_STRING_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Bytes in the UTF-8 sequence that starts with `lead`; stray continuation
+// and invalid bytes count as one so a bad byte never stalls a scan.
+inline size_t utf8SequenceLength(uint8_t lead) {
+  if (lead >= 0xF0 && lead < 0xF8) return 4;
+  if (lead >= 0xE0) return lead < 0xF0 ? 3 : 1;
+  if (lead >= 0xC0) return 2;
+  return 1;
+}
+
+// Longest prefix of text[0, length) that does not end inside a code point
+inline size_t utf8Truncate(const char* text, size_t length) {
+  size_t start = length;
+  while (start > 0 && ((uint8_t)text[start - 1] & 0xC0) == 0x80 && length - start < 3) start--;
+  if (start == 0) return length;
+  size_t lead = start - 1;
+  size_t need = utf8SequenceLength((uint8_t)text[lead]);
+  return need > length - lead ? lead : length;
+}
+
+// Decodes the code point at `p` and moves past it. A malformed sequence
+// comes out as U+FFFD and consumes one byte.
+inline uint32_t utf8Next(const char*& p) {
+  uint8_t lead = (uint8_t)*p;
+  size_t n = utf8SequenceLength(lead);
+  if (n == 1) {
+    p++;
+    return lead < 0x80 ? lead : 0xFFFD;
+  }
+  uint32_t cp = lead & (0x7F >> n);
+  for (size_t i = 1; i < n; i++) {
+    if (((uint8_t)p[i] & 0xC0) != 0x80) {
+      p++;
+      return 0xFFFD;
+    }
+    cp = cp << 6 | ((uint8_t)p[i] & 0x3F);
+  }
+  p += n;
+  return cp;
+}
+
+// NUL-terminated text in an inline buffer of N bytes, so it can live in
+// NavFrame and be copied around without touching the heap. Anything that
+// does not fit is cut at the last whole UTF-8 code point.
+template <size_t N>
+class FixedString {
+public:
+  FixedString() : length_(0) { data_[0] = '\0'; }
+  FixedString(const char* text) { assign(text); }
+
+  FixedString& operator=(const char* text) {
+    assign(text);
+    return *this;
+  }
+
+  void assign(const char* text) { assign(text, strlen(text)); }
+  void assign(const char* text, size_t length) {
+    length_ = 0;
+    append(text, length);
+  }
+
+  // Appends as much of text[0, length) as fits; false if anything was cut
+  bool append(const char* text, size_t length) {
+    size_t room = N - 1 - length_;
+    size_t n = length <= room ? length : utf8Truncate(text, room);
+    memcpy(data_ + length_, text, n);
+    length_ += n;
+    data_[length_] = '\0';
+    return n == length;
+  }
+
+  void clear() {
+    length_ = 0;
+    data_[0] = '\0';
+  }
+
+  // Lets a reader fill the buffer in place; commit() with the bytes written
+  char* buffer() { return data_; }
+  void commit(size_t length) {
+    length_ = utf8Truncate(data_, length < N - 1 ? length : N - 1);
+    data_[length_] = '\0';
+  }
+
+  const char* c_str() const { return data_; }
+  size_t size() const { return length_; }
+  bool empty() const { return length_ == 0; }
+  static size_t capacity() { return N - 1; }
+
+  template <size_t M>
+  bool operator==(const FixedString<M>& other) const {
+    return length_ == other.size() && memcmp(data_, other.c_str(), length_) == 0;
+  }
+  template <size_t M>
+  bool operator!=(const FixedString<M>& other) const { return !(*this == other); }
+  bool operator==(const char* text) const { return strcmp(data_, text) == 0; }
+
+private:
+  char data_[N];
+  uint16_t length_;
+};
+
+#endif
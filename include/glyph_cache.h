@@ -0,0 +1,80 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include <stdint.h>
+#include <clib/u8g2.h>
+#include "config.h"
+
+// RAM cache of decoded u8g2 glyphs. Drawing text through u8g2 searches the
+// font for every code point and decodes its RLE bitmap again on each
+// redraw; navigation text reuses a small alphabet, so the decoded glyphs
+// are kept here instead, LRU, keyed by font and code point.
+
+#define GLYPH_RUNS_MAX 64  // larger glyphs keep only their metrics
+// Drawn for a code point the font lacks, if the font has it (fontmaker.py
+// always adds one)
+#define GLYPH_FALLBACK 0xFFFD
+
+struct Glyph {
+  const uint8_t* font;
+  uint16_t encoding;
+  bool found;      // false if the font has neither it nor GLYPH_FALLBACK
+  bool fallback;   // the metrics and runs are GLYPH_FALLBACK's
+  bool hasRuns;    // false if it did not fit GLYPH_RUNS_MAX
+  int8_t advance;
+  uint8_t width;
+  uint8_t height;
+  int8_t xOffset;  // top left pixel is at (pen x + xOffset,
+  int8_t yOffset;  //                      baseline - height - yOffset)
+  // The font's RLE bitmap with the repeats expanded: pairs of background
+  // and foreground pixel counts, left to right, wrapping at `width`
+  uint8_t runCount;
+  uint8_t runs[GLYPH_RUNS_MAX][2];
+};
+
+// Reads one glyph out of a u8g2 font; with `withRuns` false only the
+// metrics are decoded
+bool fontDecodeGlyph(const uint8_t* font, uint16_t encoding, Glyph& glyph, bool withRuns = true);
+
+class GlyphCache {
+public:
+  GlyphCache();
+
+  // The glyph for `encoding` in `font`, decoded on a miss; the font's
+  // GLYPH_FALLBACK stands in for one it does not have
+  const Glyph& get(const uint8_t* font, uint16_t encoding);
+
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+  void resetCounters() { hits_ = misses_ = 0; }
+
+private:
+  static const uint8_t NONE = 0xFF;
+  static uint8_t bucketOf(const uint8_t* font, uint16_t encoding);
+  void unlink(uint8_t slot);
+
+  struct Entry {
+    uint32_t lastUse;  // 0 = empty
+    uint8_t next;      // next slot in the same bucket
+    Glyph glyph;
+  };
+
+  Entry entries_[GLYPH_CACHE_ENTRIES];
+  uint8_t buckets_[GLYPH_CACHE_ENTRIES];
+  uint32_t clock_;
+  uint32_t hits_;
+  uint32_t misses_;
+};
+
+// Shared by every text path on both displays
+extern GlyphCache glyphCache;
+
+// Drop-in replacements for the u8g2 calls, served from glyphCache. They use
+// the u8g2 object's current font, draw color and font mode.
+int16_t drawGlyph(u8g2_t* u8g2, int16_t x, int16_t y, uint16_t encoding);
+int16_t drawGlyphString(u8g2_t* u8g2, int16_t x, int16_t y, const char* text);
+// Same width as u8g2_GetUTF8Width: advances, with the last glyph counted to
+// the edge of its ink
+int16_t glyphStringWidth(u8g2_t* u8g2, const char* text);
+
+#endif
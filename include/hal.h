@@ -0,0 +1,63 @@
+#ifndef HAL_H
+#define HAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+#include "link_tuner.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#define PROGMEM
+#endif
+
+// Hardware touchpoints of the app logic. The firmware implements them in
+// src/main.cpp, the host build (env:native) in src/native/hal_native.cpp.
+
+uint32_t halMillis();
+uint32_t halMicros();
+// printf to the console
+void halLog(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+// Status characteristic: notifications and whether anyone listens to them
+void halNotifyStatus(const uint8_t* data, size_t length);
+bool halStatusSubscribed();
+// Transfer characteristic: ACK notifications (transfer_receiver.h)
+void halNotifyTransfer(const uint8_t* data, size_t length);
+
+// BLE link of the current connection (link_tuner.h). The requests go to
+// the peer, which may refuse them or settle on other values; they return
+// false when the stack could not start them. Outcomes arrive through
+// appLinkParamsUpdated() / appLinkPhyUpdated(), after which halLinkRead()
+// has the new state.
+bool halLinkRequestPhy2M();
+bool halLinkRequestParams(const LinkParams& params);
+void halLinkRead(LinkState& state);
+
+// Wakes the render task early (a frame was published, the link changed);
+// safe to call from the BLE task
+void halRenderWake();
+// Wakes the ingest task (a write was queued); called from the BLE callback
+void halIngestWake();
+
+// Powers up the panel with a cleared screen
+void halDisplayBegin();
+
+#ifdef USE_OLED_GME128128
+#include <clib/u8g2.h>
+// Full frame buffer SH1107; drawing goes through the u8g2 C API
+u8g2_t* halOled();
+#endif
+
+#ifdef USE_TFT_ST7789
+// RGB565 panel
+void halTftFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+// Streams pixels into an address window; a push has gone out when it
+// returns, so its buffer can be refilled right away.
+void halTftBeginWindow(int16_t x, int16_t y, int16_t w, int16_t h);
+void halTftPushPixels(const uint16_t* pixels, uint32_t count);
+void halTftEndWindow();
+#endif
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef ICON_CACHE_H
+#define ICON_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Small LRU cache of decoded maneuver bitmaps keyed by the CRC-32 of the
+// packed bitmap, so the app can send an icon reference instead of pixels.
+class IconCache {
+public:
+  IconCache();
+
+  static uint32_t hash(const uint8_t* bitmap);
+
+  // Returns the cached bitmap and marks it most recently used, or nullptr.
+  const uint8_t* find(uint32_t key);
+  void insert(uint32_t key, const uint8_t* bitmap);
+
+  // Restores entries saved by insert() when ICON_CACHE_PERSIST is defined;
+  // a slot whose bitmap does not match its hash is left empty.
+  void load();
+
+  uint32_t hits() const { return hits_; }
+
+private:
+  struct Entry {
+    uint32_t key;
+    uint32_t lastUse;  // 0 = empty
+    uint8_t bitmap[BITMAP_BYTES];
+  };
+
+  void save(size_t slot);
+
+  Entry entries_[ICON_CACHE_ENTRIES];
+  uint32_t clock_;
+  uint32_t hits_;
+};
+
+#endif
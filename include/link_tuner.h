@@ -0,0 +1,124 @@
+#ifndef LINK_TUNER_H
+#define LINK_TUNER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Connection tuning for the data link. Right after connecting, and again
+// whenever writes arrive, the link asks for 2M PHY and the fast connection
+// parameters; after LINK_IDLE_MS without writes it drops to the relaxed
+// ones. A plain state machine: the caller feeds it the clock and the
+// connection events, performs the request poll() returns, reports back
+// whether it went out and, once the controller says how the procedure
+// ended, whether the peer took it. One procedure runs at a time.
+
+// Connection parameters in BLE units: intervals of 1.25 ms, timeout of 10 ms
+struct LinkParams {
+  uint16_t minInterval;
+  uint16_t maxInterval;
+  uint16_t latency;  // connection events the peripheral may skip
+  uint16_t timeout;
+};
+
+// What the link actually runs at, as the controller reports it
+struct LinkState {
+  uint16_t mtu;
+  uint8_t txPhy;     // 1 = 1M, 2 = 2M, 3 = coded; 0 = unknown
+  uint8_t rxPhy;
+  uint16_t interval;
+  uint16_t latency;
+  uint16_t timeout;
+};
+
+inline bool operator==(const LinkState& a, const LinkState& b) {
+  return a.mtu == b.mtu && a.txPhy == b.txPhy && a.rxPhy == b.rxPhy && a.interval == b.interval &&
+         a.latency == b.latency && a.timeout == b.timeout;
+}
+inline bool operator!=(const LinkState& a, const LinkState& b) { return !(a == b); }
+
+enum LinkProfile : uint8_t {
+  LINK_PROFILE_NONE,     // not connected, or nothing requested yet
+  LINK_PROFILE_FAST,     // frames streaming
+  LINK_PROFILE_RELAXED   // idle
+};
+
+enum LinkRequest : uint8_t {
+  LINK_REQUEST_NONE,
+  LINK_REQUEST_PHY_2M,
+  LINK_REQUEST_FAST,
+  LINK_REQUEST_RELAXED
+};
+
+extern const LinkParams linkFastParams;
+extern const LinkParams linkRelaxedParams;
+
+class LinkTuner {
+public:
+  LinkTuner() { disconnect(); }
+
+  void connect(uint32_t now);
+  void disconnect();
+  // A data write arrived at `lastWriteMs`
+  void write(uint32_t lastWriteMs) { lastWrite_ = lastWriteMs; }
+
+  // The request to make now, if any
+  LinkRequest poll(uint32_t now);
+  // Whether the request poll() returned went out. Parameters the stack
+  // could not start (another procedure in flight) are asked for again
+  // after LINK_RETRY_MS; a PHY request counts as refused.
+  void requested(LinkRequest request, bool sent, uint32_t now);
+  // Connection update complete: `ok` when the peer took the parameters.
+  // Refused ones are not asked for again until the wanted profile changes.
+  // Updates the central starts on its own leave applied() alone.
+  void paramsUpdated(bool ok, uint32_t now);
+  // PHY update complete: `on2M` when the link now runs on 2M. A refusal
+  // is retried once after LINK_PHY_RETRY_MS; after that the link stays on
+  // 1M (classic ESP32 controllers have no 2M PHY).
+  void phyUpdated(bool on2M, uint32_t now);
+  // Milliseconds until poll() may have something to do; 0xFFFFFFFF if only
+  // an event can change that
+  uint32_t nextPollMs(uint32_t now) const;
+
+  bool connected() const { return connected_; }
+  // The profile the link should be on / the last one the peer accepted
+  LinkProfile wanted(uint32_t now) const;
+  LinkProfile applied() const { return applied_; }
+  bool phyRefused() const { return phy_ == PHY_REFUSED; }
+
+private:
+  enum PhyState : uint8_t {
+    PHY_WANTED,    // to be requested at phyRetryAt_
+    PHY_PENDING,   // requested, waiting for the update
+    PHY_2M,
+    PHY_REFUSED    // LINK_PHY_ATTEMPTS requests failed
+  };
+
+  bool inFlight() const { return phy_ == PHY_PENDING || pending_ != LINK_PROFILE_NONE; }
+  void phyFailed(uint32_t now);
+
+  bool connected_;
+  PhyState phy_;
+  uint8_t phyAttempts_;
+  uint32_t phyRetryAt_;
+  LinkProfile applied_;
+  LinkProfile pending_;   // requested, waiting for the update
+  LinkProfile refused_;   // the peer turned it down
+  uint32_t lastWrite_;
+  uint32_t retryAt_;
+  bool retrying_;
+};
+
+const char* linkProfileName(LinkProfile profile);
+const char* linkRequestName(LinkRequest request);
+
+// CMD_LINK_STATUS frame for the status characteristic
+#define LINK_TLV_MTU      0x01  // u16
+#define LINK_TLV_PHY      0x02  // tx (u8), rx (u8)
+#define LINK_TLV_PARAMS   0x03  // interval, latency, timeout (u16 each, BLE units)
+#define LINK_TLV_PROFILE  0x04  // u8 LinkProfile
+#define LINK_FRAME_MAX    (5 + 3 + 2 + 3 + 2 + 3 + 6 + 3 + 1 + 4)
+
+size_t linkStatusFrame(const LinkState& state, LinkProfile profile, uint8_t* buffer, size_t capacity);
+
+#endif
@@ -1,635 +1,198 @@
-#ifndef _ROBOTOFONT_H
+#ifndef _MYFONT_H
+#define _MYFONT_H
 
-#include "Arduino.h"
-#include "Print.h"
+#include <stdint.h>
+#include "hal.h"
 
-const uint8_t myfont[20060] PROGMEM = 
-  "\14\0\4\3\5\5\5\6\6#\35\366\372\20\373\20\373\2\265\5\303\21\224 \6\0@\320\4!\11\2"
-  "J\320\204\17\206\10\42\14\306D\365\4\21\236H\204D\0#$\14B\220%\31)\31)\31\251\240\220"
-  "\203\7\63\252d\244\202\242\204b\16\36\214\310H\5E\11E\311\10\1$&jF\217\255\60\233\211\10"
-  "\65!\64!\64A#Q\23avd\21S!\64!\64!%!\22\23\64v\221A\0%\60\61\306"
-  "o\26\62!\21\251 \31!\65\252dT\311\210\310\211($\221\7\210\231\24\261\213\21\21\223\11\12\13"
-  "J%\224*JDH\214*P\4\0&$\15F\320%B\211\61\231)!)\31\71\211\271B\272\211"
-  "\61\31\21\11)\11U$b#S$+Fl\4'\10\302D\225\204\203\2(\26\245\306\355\244\30\21"
-  "\31\21\31Md\64\222\321HF(H(\0)\30\246\306\355\214(\251(\251(!UQBj\204\264"
-  "\21\22\12\222\21\2*\16\307\304\24\235\260\230\223\241\31\11\11\0+\16K\305\221\255\320\254\16\36D\205"
-  "f\5,\12\242\310\316\4\212\10\11\0-\10F\304\362\204\203\2.\7BH\320\4\2/\22\6B\320"
-  "$EQA\212\202\24E\5)\12R\4\60\24\12F\220\35\252\23!\21)\62\376\231\204\220\310\32\23"
-  "\0\61\17\6J\220\255 \231\211\203\210\31!\375\7\62\24\12F\220\235\232\203\20\241\62\62A\271\71e"
-  "{wp`\63\33\12F\220\35\242\203\20!\11\251A\71\271)\302IAA\262*\211\221\31\23\0\64"
-  "\33\13B\220=I\301\71\62\11\61\11)\21!\31!\31E\42\7\17\342$\65\1\65\32\12F\220\225"
-  "\203\220\203\10AM\242\16\42h\312\4\25\222UI\214\314\230\0\66\32\12F\220\235\242\23\241\11)B"
-  "\25%$\23Sd\234IHI\214\14\225\0\67\24\12F\220\205\7\206r\12\345\344\346\4\345\4\265\23"
-  "\24\3\70\34\12F\220\35\252\23!\21)\11)\11!\221E\65\63\22b\234UI\214\314\230\0\71\32"
-  "\12F\220\35\242\203\20!\11\61\236I\314\214\34\4\211\10\222\25\211\254\251\1:\10\202I\320\4s\2"
-  ";\13\342\311\316\4s\212\10\11\0<\17KE\221M\71\242\42*\272\311J\226\3=\13\313\304\222\205"
-  "\17\342\321\34\20>\20KE\221\5I\312J\206SEDe\203\0\77\30\12F\220\25\233\221\211)\62"
-  "\211\60A\71\271\261u\202\362\320\202B\0@\77\264\306\315\276\203P\232:\311)a\31)\61\21\241\203"
-  "\30\11\31\241\31\211\230\241\65bB\63bA$bB$bB$b\62\22\62B#\62\42\26E\62"
-  "$d\342\62\302C\203s\7\305e\0A#\17B\320\265\341YZ\11I\21I\221A\31\71!\71)"
-  "\251\203\251\3\42\71\31A\31\301\21I\11\321\1B\42\14J\320\205\203\240\203\21\61\21\71\11\71\11\71"
-  "\11\251\221\3\231\203\21\71\11\271\356$\16F\16d\0C\34\16F\20\246\263\3\241\251\21\301\11\311Z"
-  "a\215\207%%\4G\304f\16\306n\0D\36\15J\20\206\3\241\203\31\261\21\271\11A\11\301J\36"
-  "\26J\10J\210\215\34\314\34\10\1E\26\14J\320\205\3\212\3\12Q\235\36P\34P\210\352\364\340\301"
-  "\0F\21\13J\260\205\17&uy r \42\251/\1G!\17F\60\256\263\203\241\261\221A\21Q"
-  "\11aie\7b\7\243\22\242\22\223\42s\63\7d\67\0H\15\14J\20\6A~x\360!\77\24"
-  "I\10\2J\320\204\37\20J\16\10Fp\65\375gD\214\16&,\0K#\14J\320\5\271\262\11\251"
-  "\21\241\31\231!\221)\211\261+\12\251\221!\241\31)\31\61\21\261\11\271B\1L\14\12J\220\5A"
-  "\375\77<\70\60M,\17JP\206I\313\273\203\270\203\60\11\12)\11\12\251\20\12!\21\22\31\21\22"
-  "\231\30\22\65\64\22\62\64\22A\64DDCDR\2N\35\14J\20\6\301\272:\263+\12)\22!"
-  "\222\31\32\31\42\21\242\11*\11\62w\205\2O\35\17F\60\246\273\203\241\261\221A\21ISZnK"
-  "%$'\6e\306\206\16\306\216\0P\27\14J\320\205\3\231\3\12\71\11\271Bve\23\7#W\242"
-  "z\12Q\35/\306/\246\273\3\251\61\31I\21\311Z\276\225\220\234\220\22\221\221\242:\30\273\230\26R"
-  "%\15J\20\206\203\231\3\22\271\11A\11A\11A\11\271\211\3\222\3!)!\251\31\261\21\271\11A"
-  "\11\301J\1S\35\15F\320\235\253\3\31\261\21\71\21\71\21\331\322C\333\331\312\272\11\71\221\203\251\33"
-  "\0T\15\14F\260\205\17\246D\365\377\12\0U\20\14J\20\6A\376\37\226M\34\314\34\204\0V!"
-  "\16B\320\205I\11I\11I\211\71\31\71\31\261!)\35\311\311\310\311\10\206HJHJ\304\256\2W"
-  ";\25B\220\206\261\71\11\261\61\21\261\210\60\21)\11)\21)\11)\31!\11!\65\32\311h$\243"
-  "&L$*DLBJBLBJB.BJ\42\60\42npnpN\12\0X!\16B\320\215"
-  "A\21\71!)\251\231\61\31A\11I\332\245\22\202\23c\63bRBb#s\226\2Y\31\16B\320"
-  "\205I\211\271\21\71\231)\251\231\61\31\271\11\311\322Ya}\6Z\25\15B\260\215\203\212\203R\321\311"
-  "M\225N.Uz\360\240\0[\14\204J\316\204\3\231\374\377\15\1\134\24\6B\320\4!\251(!\251"
-  "TBRQBR\251\204\4]\14\205B\316\204\203\31\375\377\315\1^\24)\305S\35\271)*\11\31"
-  "\21\31\25B\22B\22R\2_\10-@\216\205\3\3`\11d\304\366\204\21\31\1a\26\212E\220\235"
-  "\232\203\20\241\62A\231\13\213*\62*\33\12\13\1b\26\12F\220\5A\235\314HX\320X\221qV"
-  "Ue\62!Q\2c\22\212Ep\35\252\23!\11\61B\235\25\211\254\61\1d\26\12F\220E\335\214"
-  "H\34H\10U\225\361\254hb\204\244B\0e\25\212E\220\35\252\23\241\62\262\203\7\203bU\22#"
-  "\63&\0f\20\7B\320\34\222\22)\31\13\33)\375\33\0g\32*\306\215\235\21\211\3\11\241\62>"
-  "\223\20\232\70\20\251\20$+\22\271\32\2h\22\12F\220\5A\235\220HX\320XU\221\361\63\1i"
-  "\12\2F\220\4\242\203\7\3j\15\244\276\215\24\245\42\372\177r \1k\33\12Fp\5A]\25M"
-  "\310(\21\222\220\62\232\20\222Q\63\42$\42%!\65l\10\2F\220\204\37\20m \220EP\6\221"
-  "\241\21\11\213\12\232\241\242\241\42)*)*)*)*)*)*)*\5n\20\212E\220\5\21"
-  "\22\11\13\32\253*\62~&o\30\213E\220\35\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l"
-  "\0p\27\12F\216\5\221\31\11\13\32+\62\316\252\252L&$J\4\65\4q\26\12F\216\235\21\211"
-  "\3\11\241\252\62\236\25M\214\220T\10\352\0r\16\206E\360\4\21\212\223\231\31!}\4s\24\211E"
-  "p\25\242\13\241\252\210\271\262\272*\252\232\211\13\0t\17\346\301\320\24!%\7%B\372\21\11\1u"
-  "\20\212E\220\5\61\376\231\204\320\304DI\205\0v\32\213Ap\5\71\11)\21)\21)\31E\62R"
-  "\61R\22b\22r\203\213\0w)\220A\20\6))*\25\62\64\42\62\64\42\62\64\62IB\204$"
-  "D$\204$D$\244\42D$\302\206\306\206\306\206\204\0x\31\213Ap\205\251\211!\31U\22bu"
-  "\203se\22R\62\62C\42R\3y +\302m\5\71\11\61\11)\31!\31E\62R\42R\22b"
-  "\22rt\223\222\221\202c\204r\0z\22\213Ap\215\3\221\3\301\271A\35\316\315\35<\10{\24\246"
-  "\306\355\234\21\22!\275\221\231\221\222\212\22\322#\42\1|\7\242\312\255\204\177}\26\246\306\355\204\231\251"
-  "(!\275\232\31\231\21\322Q\220\314\214\20\0~\15\213D\223\25\271\233\211\203\60\12\0\240\6\0@\320"
-  "\4\241\14\2N\356\4\223\210\24\7\7\4\242$\212F\216=\301\310dD'\62\24\42\22\64A\62A"
-  "\62A\42B\42\61\22\22\61\22\24CU\201\12\343\0\243\32\14B\220\245\262\211!)\31)\31Q\205"
-  "\7A\7q\242*U\36\220\310\30\244\31J\305\221\5\271\3\212\221\21!\221\60\211\60\11)\211\31\211"
-  "\203\222\11\1\245\36\14B\220\5A\11\61\21\61\31!\241\31)\21\71\11\71\252\3*Q\261\3*Q"
-  "\255\0\246\13\242\312\255\204\7\202\7\7\4\247'\252\306\215\25\233\221\21!\21!\221\301\261\42\21\22\241"
-  "\11)+\211!\21\22\241\262I\231\240\11)\211\31\231\253\31\0\250\11FD\367\4\21\22\1\251)\20"
-  "B\20.\303\241)A\31!%\61\66\64A\62#\222\62\241\62\241#\222#B\62\21\61\66\22B\63"
-  "\12\245\206\6\217\0\252\23\7E\24\215\12\21\261\220\12\231\210\240\10\211\221\11\1\253\26I\311\220\235\30"
-  "\21mbD\264\21\221\321DHDF&\2\0\254\11\313\304\222\205\17\42u\255\10F\304\362\204\203\2"
-  "\256/\20B\20.\303\241)A\31Q\221\30\33\232\240\240\231\240 \241\30!\241\252\231\20\251\231\30\241"
-  "\210\230\240\30\11\221 \11\31A\251\241\301#\0\257\10-\300\230\205\3\3\260\15\306D\25\15\222\230\65"
-  "\21J&\0\261\20\252E\220%A\215\16\16\214\4\65\77\70\60\262\15\7A\364\24\22Ujf\204\204"
-  "\16\263\17\6E\364\204\12\21!\221)\241\231\13\0\264\11c\314\366\14\212\20\0\265\16\11J\216\5)"
-  "\376\243\203\7r\332\1\266/\214Bn\235\3\211\203\203\231\20\233\20\233\20\233\20\233\230\232 \232\60\231"
-  "\60\231\60\231\60\231\60\231\60\231\60\231\60\231\60\231\60\231\60\231\20\0\267\7B\310\323\4\2\270\13\245"
-  "\304\355\224\230\241\13\21\0\271\12\4E\364\24\211\212\230<\272\24\10A\24\25\32\21\221\240\10!\211 "
-  "\211\240\20\33\22\0\273\26I\311\220\205\230 \21!\21\31MdDFt\23#\242\6\0\274,\61\306"
-  "O\26I\231A\31\211\300\270\70\271\60\301\260\310(\311 y\200(A)\71\251\61)\211\260(\221("
-  "\241\33\251\233\330\30i\0\275*\61\306O\26I\231A\31\211\300\270\70\271\60\301(\311\250\320 q\31"
-  "\302\30\63\231\30)A!A\251@)\261)\71\223p\0\276*\61\306O\206B\21erbac\202"
-  "B\222Ba\61\312j\344\1\242\4\245\344\244\306\244\310\242$\244\204n\244nBe\244\1\277\26*\312"
-  "\255%A\365\60\202\352\344\306\344\4\225Q\31\211\134\15\1\300&\217B\320\255iqy\340\265\264\22\222"
-  "\42\222\42\203\62rBrRR\7S\7Dr\62\202\62\202#\222\22\242\3\301&\217B\320\275a\365"
-  "\320\303\263\264\22\222\42\222\42\203\62rBrRR\7S\7Dr\62\202\62\202#\222\22\242\3\302("
-  "\217B\320\65aR\21y\330\341YZ\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31"
-  "\301\21I\11\321\1\303(oB\320%\12\301\220y\330\341YZ\11I\21I\221A\31\71!\71)\251"
-  "\203\251\3\42\71\31A\31\301\21I\11\321\1\304(oB\320%\21I\21y\330\341YZ\11I\21I"
-  "\221A\31\71!\71)\251\203\251\3\42\71\31A\31\301\21I\11\321\1\305'oB\320\265\331\220\330\220"
-  "\340\265\264\22\222\42\222\42\203\62rBrRR\7S\7Dr\62\202\62\202#\222\22\242\3\306)\25"
-  "B\320\276\203\273\203;\21q\31q\31i!i!a\251\3)\251\3!\61\331\203Q\71Q\71IA"
-  "I\301\3\303\203\1\307!\256\306\15\246\263\3\241\251\21\301\11\311Za\215\207%%\4G\304f\16\306"
-  ".\205\207EI\345\0\310\32\214J\320\235QYy\220\3\212\3\12Q\235\36P\34P\210\352\364\340\301"
-  "\0\311\31\214J\320\255I\365\60\7\24\7\24\242:=\240\70\240\20\325\351\301\203\1\312\33\214J\320\245"
-  "\301:\211y\200\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\313\33lJ\320\35\21\61\21y\200"
-  "\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\314\15\203F\320\4\21\221 \11\375\377\0\315\15\203"
-  "J\320\14\12!\11\375\377\2\0\316\17\206B\320\24\31\12\21A!\375\377\4\0\317\16fB\320\4\21"
-  "\22A!\375\377\4\0\320'\17B\20\226\3\261\203)\261!\271\31A\31\301\21\311\203\251\203)\21I"
-  "\21\301\21A\31A\31\261\241\203\251\3!\0\321\42lJ\20\36\12\251\220y\0\301\272:\263+\12)"
-  "\22!\222\31\32\31\42\21\242\11*\11\62w\205\2\322!\217F\60\256iqy\320\273\203\241\261\221A"
-  "\21ISZnK%$'\6e\306\206\16\306\216\0\323!\217F\60Fa\351x\330\273\203\241\261\221"
-  "A\21ISZnK%$'\6e\306\206\16\306\216\0\324\42\217F\60\266\331R\211y\300\273\203\241"
-  "\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\325!oF\60.C\11z\300\273\203"
-  "\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\326\42oF\60.\21I\21y\300"
-  "\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\327\22\11I\222\5)\11\31"
-  "\25RcS\22\62*\244\4\330)\17\306/\246\233\230\3\211\230\261\221\271\21\271\203\60\21\62\31*!"
-  "\42)\32\61\232\70\11e\23t\62c#\7%\42G\0\331\24\214J\20&QYy\20A\376\37\226"
-  "M\34\314\34\204\0\332\24\214J\20\66\311Iy\20A\376\37\226M\34\314\34\204\0\333\25\214J\20."
-  "I:\21y\0A\376\37\226M\34\314\34\204\0\334\25lJ\20\36\21\61\21y\0A\376\37\226M\34"
-  "\314\34\204\0\335\35\216B\320\275Y\365P\223\22s#r\62SR\63c\62r\23\222\245\263\302\372\14"
-  "\0\336\32\14J\320\5Q\245\7A\7#b\23r\205\354\312&\16F\16\202D\225\2\337$\13J\260"
-  "\225\42\212\31!\31!\31!\31E\62B\62B\62BB#R\23bu\24B\24#\22\42%\0\340"
-  "\32\12F\220\235AIy\210\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\341\31\12F\220\255\71"
-  "\365 \65\7!Be\202\62\27\26UdT\66\24\26\2\342\33\12F\220%\71*\21y\200\232\203\20"
-  "\241\62A\231\13\213*\62*\33\12\13\1\343\34\12F\220\35\21\231\23\31y\200\232\203\20\241\62A\231"
-  "\13\213*\62*\33\12\13\1\344\32\12F\220\25E\42\362\240\65\7!Be\202\62\27\26UdT\66"
-  "\24\26\2\345\34\12F\220\35\262\220\260\220\70\271\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\346"
-  "&\222Ep\36\42\242\203\203\30!\42\11\61)I\61\231\203\203\10\213\3+A\251\61\252)\211\221\211"
-  "\221\21\33\23\0\347\26\12Fn\35\252\23!\11\61B\235\25\211\254\61\213\34\224\42\2\350\31\12F\220"
-  "\35IAy\20\252\23\241\62\262\203\7\203bU\22#\63&\0\351\30\12F\220\255\71\365 T'B"
-  "ed\7\17\6\305\252$FfL\0\352\32\12F\220\245\61*\21y\0\252\23\241\62\262\203\7\203b"
-  "U\22#\63&\0\353\31\12F\220\25E\42\362\240T'Bed\7\17\6\305\252$FfL\0\354"
-  "\14\3F\320\4\21\11!\11\375\17\355\14\4J\320\214\11e\42\372\237\0\356\16\6B\320\224\21\12\21"
-  "A!\375O\0\357\15\6B\320\4\21\22q!\375O\0\360\27\12F\220\35\231(V\42b!\62'"
-  "Be|V%\61\62c\2\361\25\12F\220\35\231\230\233\30a\21\22\11\13\32\253*\62~&\362\34"
-  "\13F\220\35QIy \262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\363\33\13F\220\255"
-  "A\365@d\67B\23b\22b\22r\314$\304$\246D\26\331\0\364\35\13F\220\245\71\62\21y\20"
-  "\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\365\36\13F\220\35\21\241\243\30y\20\262\33"
-  "\241\11\61\11\61\11\71f\22b\22S\42\213l\0\366\34\13F\220\25U\42\362\320d\67B\23b\22"
-  "b\22r\314$\304$\246D\26\331\0\367\16*\305\221%A\361\203\3sAE\0\370 \253\305\257%"
-  "\12\221\203\220!\21!\12\31\11\242\20\232\230\12\31\11\42\211\241\221%\7\61\221\0\371\23\12F\220\235"
-  "AIi\61\376\231\204\320\304DI\205\0\372\22\12F\220\255\71\345b\374\63\11\241\211\211\222\12\1\373"
-  "\24\12F\220%\71*\21a\61\376\231\204\320\304DI\205\0\374\24\12F\220\25E\42\362pb\374\63"
-  "\11\241\211\211\222\12\1\375$\253\302m\65AIy\0\71\11\61\11)\31!\31E\62R\42R\22b"
-  "\22rt\223\222\221\202c\204r\0\376\31\212F\216\5A\235\314HX\320X\221qVUe\62!Q"
-  "\42\250!\0\377%\253\302m\35\21)\21yH\71\11\61\11)\31!\31E\62R\42R\22b\22r"
-  "t\223\222\221\202c\204r\0\0\0\0\24\1d\12\316\3\244\11\350\4<\13>\5\346\10y\377\377\1"
-  "\0'oB\320\245\303{\320\341YZ\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31"
-  "\301\21I\11\321\1\1\1\31\352E\220\225\233\363\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\1"
-  "\2)\217B\320%\31A\231Pz\340\265\264\22\222\42\222\42\203\62rBrRR\7S\7Dr\62"
-  "\202\62\202#\222\22\242\3\1\3\35\12F\220\25\31!\11\261y\210\232\203\20\241\62A\231\13\213*\62"
-  "*\33\12\13\1\1\4-\261\302\315\265\361ij\11Y\21Y\221Q\31I!I)\271\203\271\3\62\71"
-  ")A)\301!I\31\321qy\200x\10y\200\362\20\0\1\5 \15F\216\235\262\203(\241\31\61Y"
-  "\261#\13\231)\31\61\31\251\231\31\42\13\331\340`\331\2\1\6 \216F\20\276Y\365\220g\7BS"
-  "#\202\23\222\265\302\32\17KJ\10\216\210\315\34\214\335\0\1\7\27\12Fp-\71Ay\20\252\23!"
-  "\11\61B\235\25\211\254\61\1\1\10#\216F\20\266Q\211\310\11y\270\263\3\241\251\21\301\11\311Za"
-  "\215\207%%\4G\304f\16\306n\0\1\11\31\12Fp\245\61\11\241\11y\0\252\23!\11\61B\235"
-  "\25\211\254\61\1\1\12 \216F\20\266\331\365\200g\7BS#\202\23\222\265\302\32\17KJ\10\216\210"
-  "\315\34\214\335\0\1\13\26\352Ep\245\271y\10\252\23!\11\61B\235\25\211\254\61\1\1\14#\216F"
-  "\20\246\21A\11\321y\300\263\3\241\251\21\301\11\311Za\215\207%%\4G\304f\16\306n\0\1\15"
-  "\27\12Fp\25Ut\362 T'B\22b\204:+\22Yc\2\1\16$\215J\20\216u\22\222\363"
-  "P\7B\7\63b#r\23\202\22\202\225<,\224\20\224\20\33\71\230\71\20\2\1\17(\15F\260E"
-  "\11A\11A\221@\211\240\21\211\220\3!\241\31\251\31\61\31\61\31\61\31\61\31\61\231\241%T\25\62"
-  "\0\1\20(\17B\20\226\3\261\203)\261!\271\31A\31\301\21\311\203\251\203)\21I\21\301\21A\31"
-  "A\31\261\241\203\251\3!\0\1\21$\13F\220E\251\243C\241\21\221\3\21\241\11\251\11\61\11\61\11"
-  "\61\11\61\11\61\211\241\221\21\232\12\11\0\1\22\32lJ\320\225\253{\200\3\212\3\12Q\235\36P\34"
-  "P\210\352\364\340\301\0\1\23\30\352E\220\225\233s\252\23\241\62\262\203\7\203bU\22#\63&\0\1"
-  "\24\35\214J\320\25\31\61\221@z\210\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\1\25\34\12"
-  "F\220\25\231(\11\261y\10\252\23\241\62\262\203\7\203bU\22#\63&\0\1\26\32lJ\320-Q"
-  "y\220\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\1\27\31\352E\220\245\271y\10\252\23\241\62"
-  "\262\203\7\203bU\22#\63&\0\1\30\34\254\312\315\205\3\212\3\12Q\235\36P\34P\210\352\364\340"
-  "\301\134l\332B\21\0\1\31\32*\306\215\35\252\23\241\62\262\203\7\203bU\22#\63v\201*\351D"
-  "\0\1\32\34\214J\320\25u\22\202\363 \7\24\7\24\242:=\240\70\240\20\325\351\301\203\1\1\33\33"
-  "\12F\220\25U\22b\363\20T'Bed\7\17\6\305\252$FfL\0\1\34(\217F\60\276Y"
-  "\211X\11\311\360\263\203\241\261\221A\21Q\11aie\7b\7\243\22\242\22\223\42s\63\7d\67\0"
-  "\1\35 \252\306\215\235\71*\21y\200\21\211\3\11\241\62>\223\20\232\70\20\251\20$+\22\271\32\2"
-  "\1\36(\217F\60.\31\311\230Pz\320\263\203\241\261\221A\21Q\11aie\7b\7\243\22\242\22"
-  "\223\42s\63\7d\67\0\1\37!\252\306\215\225\240 \21)z\210\21\211\3\11\241\62>\223\20\232\70"
-  "\20\251\20$+\22\271\32\2\1 %oF\60\276\341y\320\263\203\241\261\221A\21Q\11aie\7"
-  "b\7\243\22\242\22\223\42s\63\7d\67\0\1!\36\212\306\215%Ay\220\21\211\3\11\241\62>\223"
-  "\20\232\70\20\251\20$+\22\271\32\2\1\42'\257\306-\256\263\203\241\261\221A\21Q\11aie\7"
-  "b\7\243\22\242\22\223\42s\63\7d\247\322\343\242\264r\0\1#!\312\306\215%\301HAy\220\21"
-  "\211\3\11\241\252\62\236I\10M\34\210T\10\222\25\211\134\15\1\1$\24\214J\20\256A\11\261\11y"
-  "\0A~x\360!\77\24\1%\27\212F\220-\71*\21YA\235\220HX\320XU\221\361\63\1\1"
-  "&'\20B\20\26A!A\221\203\17H\4\205\4\205\4\205\16\212\16\212\4\205\4\205\4\205\4\205\4"
-  "\205\4\205\4E\0\1'#\13B\220\15I\301+I\21\32\11\23\232\211)\211)\11\61\11\61\11\61"
-  "\11\61\11\61\11\61\11\61\1\1(\21\210>\320\224\30\11\13\221a\61\375\377\6\0\1)\17\7B\320"
-  "\14\221\203\31Q)\375o\0\1*\16fB\320\204\203B!\375\377\4\0\1+\14\347A\320\204\227R"
-  "\372\337\0\1,\20\206B\320\204\240\231\10J!\375\377\4\0\1-\17\6B\320\204\240\21\11J!\375"
-  "O\0\1.\20\245\312\315\4\31\375\377&(Q\205\10\0\1/\21\245\306\215\4\31i\31\375\337\4\311"
-  "\224\204\0\1\60\13bJ\320\4\222\203\17\10\1\61\11\202I\320\204\17\6\1\62\24\15J\20\6I\376"
-  "O\244H\244h\204h.\204J\0\1\63\24\250\306-\5!\42y\10!\376\217\304T\11\21\215\0\1"
-  "\64\32\213Fp\265\71\11\61\211y\20I\375\67B\62B\62B\62\7AF\0\1\65\21\246\276\215\224"
-  "\21\211\12A!\375\177B\62\3\1\66*\254\312\315\5\271\262\11\251\21\241\31\231!\221)\211\261+\12"
-  "\251\221!\241\31)\31\61\21\261\11\271By\20R\271B)\0\1\67!\252\306m\5A]\25M\310"
-  "(\21\222\220\62\232\20\222Q\63\42$\42%!\65N(U&\4\1\70\33\212Ep\5\251\242\11\31"
-  "%B\22RF\23B\62jF\204D\244$\244\6\1\71\21\212J\220\35\71\301x\20A\375\77<\70"
-  "\60\1:\16\204F\220\214\11e\42\372\377\11\0\1;\22\252\312\215\5A\375\77<\70\60\237\224\42\223"
-  "\2\1<\17\245\302\215\14\31\375\377p\310B\6\0\1=\27\12J\220\5!\21!\21\251\20\251\20\241"
-  "\30A\375\341\301\201\1\1>\15\5F\320\4\11&\333\350\277\1\1\77\22\12J\220\5A\375HDH"
-  "DP\207\7\7\6\1@\15\6F\360\4!\375\204\221>\2\1A\27\14B\220\25Q\235\304I\310\21"
-  "J\16\22F\210jz\60r\60\1B\21\5B\220\14\31\275\210\240\30\21Y\243'\0\1C!\214J"
-  "\20\256I\365\60\202uufW\24R$B$\63\64\62D\42D\23T\22d\356\12\5\1D\24\12"
-  "F\220-A\71q\21\22\11\13\32\253*\62~&\1E$\254\312\15\6\301\272:\263+\12)\22!"
-  "\222\31\32\31\42\21\242\11*\11\62w\205\362\60\243\202\204R\0\1F\26*\306\215\5\21\22\11\13\32"
-  "\253*\62~&>)E&\5\1G#\214J\20\36\21\71\302y\20\301\272:\263+\12)\22!\222"
-  "\31\32\31\42\21\242\11*\11\62w\205\2\1H\26\12F\220\25U\22b\323\42$\22\26\64VUd"
-  "\374L\0\1I#\14B\260\5Q\331\244\21\42D\22\66\64#S\42S\42b\42b\42b\42b\42"
-  "b\42b\42b\2\1J\33\15J\20\6\21\233\3\222\261\211\71\11\301J~X(!\67!T\42S"
-  "\3\1K\26)\312\215\205\20\222\10\213\231*\252\261}&\247\325\230\10\0\1L!oF\60\246\303{"
-  "\300\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\1M\34\353E\220\225\243"
-  "{\10\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\1N$\217F\60\256\240H\21Qz"
-  "\310\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\1O\37\13F\220\225\240"
-  "\250\11\61z\30\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\1P%\217F\60\256\11I"
-  "\21A\21y\310\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\1Q \13"
-  "F\220\235\11)\21!\21y\20\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\1R-\25"
-  "F\320\246\222\3\231\203\3\32)\312\261IAIA\301A\301\301\3\211\301\3\211AIAIAI\271"
-  "Q)R\222\3#\213\203\1\1S$\223E\220\36*\252\213\33\241\42\211\251\61\262\61\272\203\272\203:"
-  "A\261\61\11)\242\211\221\211\221\31'\0\1T*\215J\20.QYy\250\203\231\3\22\271\11A\11"
-  "A\11A\11\271\211\3\222\3!)!\251\31\261\21\271\11A\11\301J\1\1U\22\6F\360\34E\202"
-  "\42\24'\63\63B\372\10\0\1V,\255\312\15\206\203\231\3\22\271\11A\11A\11A\11\271\211\3\222"
-  "\3!)!\251\31\261\21\271\11A\11\301Jy\240YIJ\61\0\1W\23&\306\355\4\21\212\223\231"
-  "\31!}<$B\42\3\1X*\215J\20\26\205\224\364@\7\63\7$r\23\202\22\202\22\202\22r"
-  "\23\7$\7BRBR\63b#r\23\202\22\202\225\2\1Y\23\6F\360\4\21\11\232\71\21\212\223"
-  "\231\31!}\4\1Z\42\215F\320\65Q\331x\300\253\3\31\261\21\71\21\71\21\331\322C\333\331\312\272"
-  "\11\71\221\203\251\33\0\1[\31\11Fp\245\61\271x\0\242\13\241\252\210\271\262\272*\252\232\211\13\0"
-  "\1\134\42\215F\320\255I\302\11y\250\7\62b#r\42r\42\262\245\207\266\263\225u\23r\42\7S"
-  "\67\0\1]\31\11Fp\235\61\42\21a\242\13\241\252\210\271\262\272*\252\232\211\13\0\1^\42\215F"
-  "\316\235\253\3\31\261\21\71\21\71\21\331\322C\333\331\312\272\11\71\221\203\251C\331aA*\0\1_\30"
-  "\11Fn\25\242\13\241\252\210\271\262\272*\252\232\211#AE\64\0\1`#\215F\320\35\21AJz"
-  "\260\253\3\31\261\21\71\21\71\21\331\322C\333\331\312\272\11\71\221\203\251\33\0\1a\31\11Fp\215\65"
-  "\22R\343D\27BU\21seuUT\65\23\27\0\1b\23\314F\255\205\17\246D\365\377\36NT"
-  "mh\30\0\1c\25\246\302\315\24!%\7%B\372\21\11\245\220T\242\20\0\1d\24\214F\260\35"
-  "\21\61\11\301y\220\203\7S\242\372\177\5\1e\24\10B\20\65\21mBd\16\42\214\304\364\63\42\22"
-  "\0\1f\21\14F\260\205\17\246D\365\354@NT_\1\1g\22\6B\320\234 M*j\204\224\324"
-  "\10iDB\1h\27\214J\20\246\30\251\253\220y\0A\376\37\226M\34\314\34\204\0\1i\26\12F"
-  "\220\35\21\231\233\30a\61\376\231\204\320\304DI\205\0\1j\23lJ\20\236\253sA\376\37\226M\34"
-  "\314\34\204\0\1k\23\352E\220\225\233[\61\376\231\204\320\304DI\205\0\1l\27\214J\20\236\240\60"
-  "\21\71z\10A\376\37\226M\34\314\34\204\0\1m\26\12F\220\25\231\240\11)j\61\376\231\204\320\304"
-  "DI\205\0\1n\30\254J\20.\311\220\300\220Hy\20A\376\37\226M\34\314\34\204\0\1o\27\12"
-  "F\220\35\262\220\260\220\70!\61\376\231\204\320\304DI\205\0\1p\30\214J\20\246\11\61\21)\21y"
-  "\0A\376\37\226M\34\314\34\204\0\1q\27\12F\220\35\211\31\21!\221h\61\376\231\204\320\304DI"
-  "\205\0\1r\26\254\312\15\6A\376\37\226M\34\314\34\304\305\306\212\26\12\1\1s$,\306\215\5\61"
-  "\21\61\21\61\21\61\21\61\21\61\21\61\21\61\21\61\31\241\231\211\242\12\321\330\264\224\22\0\1tD\225"
-  "B\220\316y\20\11y\200\11y\360\261\71\11\261\61\21\261\210\60\21)\11)\21)\11)\31!\11!"
-  "\65\32\311h$\243&L$*DLBJBLBJB.BJ\42\60\42npnpN\12\0"
-  "\1u/\20B\20\276aZ\21y\60))*\25\62\64\42\62\64\42\62\64\62IB\204$D$\204"
-  "$D$\244\42D$\302\206\306\206\306\206\204\0\1v\37\216B\320\265\321J\211y\220I\211\271\21\71"
-  "\231)\251\231\61\31\271\11\311\322Ya}\6\1w%\253\302m-A\62\21i\71\11\61\11)\31!"
-  "\31E\62R\42R\22b\22rt\223\222\221\202c\204r\0\1x\37nB\320%\21A\21y\230I"
-  "\211\271\21\71\231)\251\231\61\31\271\11\311\322Ya}\6\1y\31\215B\260\265Q\365P\7\25\7\245"
-  "\242\223\233*\235\134\252\364\340A\1\1z\26\13Bp\255A\365 \7\42\7\202s\203:\234\233;x"
-  "\20\1{\31mB\260\65Yy\240\203\212\203R\321\311M\225N.Uz\360\240\0\1|\26\353Ap"
-  "\245\301y\210\3\221\3\301\271A\35\316\315\35<\10\1}\33\215B\260%\21\271\312y\240\203\212\203R"
-  "\321\311M\225N.Uz\360\240\0\1~\30\13Bp\35\21\61\272y\210\3\221\3\301\271A\35\316\315"
-  "\35<\10\1\177\15\5F\220\14\26\42\62\372\277\1\1\217\36\17F\20\246\273\3\251\65s#\222\322\322"
-  "\7\77-\25\221\24\21\234\21\33:\230;\2\1\222\27\253\306\215\265\62\262A\71+;IAI=\224"
-  "\324\31\335 \0\1\240(\22Fp\246\243\231\203\221e#!\203\42!\222\25\243\62\262\62\262\62\262\62"
-  "\262\62\243B\222C\203b\353\16&\357\0\1\241 \215E\320\35\42\221\23\11\241\221\61\221\61\211\10\71"
-  "\21\71\21\61\31\61\231)\241\221\61+\0\1\257(\20JP\6A\21B\21B\231A\231A\21\302\12"
-  "A!A!A!A!A!A!A\241\261\251\203\271\203\60\0\1\260 \215E\320\5\61\11\62\11"
-  "\62\11\62\221\61\221\61\211\10\261\21\61\31\61!\241\25U\25\62\0\1\315)\217B\320%\21Q\11\331"
-  "y\340\265\264\22\222\42\222\42\203\62rBrRR\7S\7Dr\62\202\62\202#\222\22\242\3\1\316"
-  "\35\12F\220\225\211!\11\261y\210\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\1\317\20\206B"
-  "\320\4\21\11\22J!\375\377\4\0\1\320\17\6B\220\4\211\12\221I!\375o\0\1\321$\217F\60"
-  ".\21I\11\331y\320\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\1\322"
-  "\35\13F\220\25e\204\363\60d\67B\23b\22b\22r\314$\304$\246D\26\331\0\1\323\27\214J"
-  "\20\36\21\71\11\301y\10A\376\37\226M\34\314\34\204\0\1\324\25\12F\220\25U\22q\323b\374\63"
-  "\11\241\211\211\222\12\1\1\325\27\214J\20\36{\30\21\61\21\31A\376\37\226M\34\314\34\204\0\1\326"
-  "\30jF\220\25#s\21!\21y\70\61\376\231\204\320\304DI\205\0\1\327\27\214J\20\66IA\21"
-  "\61\21\31A\376\37\226M\34\314\34\204\0\1\330\31\212F\220\255\71\365\20\42B\42\362pb\374\63\11"
-  "\241\211\211\222\12\1\1\331\30\214J\20&\211HA\21\61\21\31A\376\37\226M\34\314\34\204\0\1\332"
-  "\33\212F\220\25U\22q\363\0\42B\42\362pb\374\63\11\241\211\211\222\12\1\1\333\27\214J\20&"
-  "YA\21\61\21\31A\376\37\226M\34\314\34\204\0\1\334\32\212F\220\35\301Ay\10\21!\21y\70"
-  "\61\376\231\204\320\304DI\205\0\1\372+\357B\320\275a\365\320\263!\261!\301ki%$E$E"
-  "\6e\344\204\344\244\244\16\246\16\210\344d\4e\4G$%D\7\1\373!\252F\220\65\71\301x`"
-  "\262\220\260\220\70\271\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\1\374\60\225B\320^y\30y"
-  " yt\7w\7w\42\342\62\342\62\322B\322B\302R\7RR\7Bb\262\7\243r\242r\222\202"
-  "\222\202\7\206\7\3\1\375-\22Fp\316y\0y\0yp\42\242\203\203\30!\42\11\61)I\61\231"
-  "\203\203\10\213\3+A\251\61\252)\211\221\211\221\21\33\23\0\1\376.\217\306/Faiy\320\233\230"
-  "\3\211\230\261\221\271\21\271\203\60\21\62\31*!\42)\32\61\232\70\11e\23t\62c#\7%\42G"
-  "\0\1\377%+\306\257\65\301Ay \12\221\203\220!\21!\12\31\11\242\20\232\230\12\31\11\42\211\241"
-  "\221%\7\61\221\0\2Y\32\213E\220\35\252\203\30\241\11\61I\321\203\203\60\11\61\21)\221E\66\0"
-  "\2\306\13f\304\366\214\221\12\21\1\2\307\14f\304\366\4\21\11\222\21\0\2\311\10G\300\366\204\7\2"
-  "\330\14f\304\366\204\30\12\221\21\0\2\331\10C\310\366\4\3\2\332\14dH\366\204\211\20\211\10\0\2"
-  "\333\15\245\310\355\4\231 \231\12\21\0\2\334\14g\300\366\14\231\203\21\11\0\2\335\15g\304\366\14\21"
-  "\22\11\221\20\0\3\0\12d\250\30\204\21\31\1\3\1\12d\260\30\214\11%\0\3\3\12G\230\30\14"
-  "\212\11\2\3\11\14\205,\30\4\42\211\21\21\0\3#\10b \16\4\3\3~\14\342\311\316\4s\212"
-  "\10\11\0\3\204\12c\314\366\14\212\20\0\3\205\13h\300\366\34\25!&\2\3\206'\17B\320\25\221"
-  "\71\231\71\21Z\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31I\21I\11\321\1\3"
-  "\207\10b\310\324\4\3\3\210)\21>\60\216\211\203\12\221\203\33y\0y\0y\0y\0y\200\3\262"
-  "\3\62y\0y\0y\0y\0y\200\203\252\203\2\3\211)\21>P\216\11A\11\21A\32A)A"
-  ")A)A)A\251\203\252\203*A)A)A)A)A)A)A\1\3\212\15\7>\20\215"
-  "\11%\64R\372\177\3\214)\21>\60\216\221+\221\3\31\221\61)I!\311\21Y\21Y\21Y\21Y"
-  "\21Y\21Y\31\311\31I)\71\271\203\301#\0\3\216(\23>p\216\225\22\62sUr\202S\242\63"
-  "\263\62\302\23\342\365\0\363\20\362 \362 \362 \362 \362 \362 b\0\3\217'\21>\20\216\221+"
-  "\221\3\31\221\251uC\222B\222\62\223\62\223\62\223B\222B\222B\222ar\252\244LNL\16\3\220"
-  "\20\7>\220\34\221$\22\61\221R\372\337\0\3\221$\17B\320\265\341YZ\11I\21I\221A\31\71"
-  "!\71)\251\203\251\3\42\71\31A\31\301\21I\11\321\1\3\222#\14J\320\205\203\240\203\21\61\21\71"
-  "\11\71\11\71\11\251\221\3\231\203\21\71\11\271\356$\16F\16d\0\3\223\15\12J\220\205\17\2\365\377"
-  "\20\0\3\224$\17B\320\265\341YZ\11I\21I\221A\31\71!\71)\251)eCr\62\202\62\202"
-  "#\7\26\7\7\1\3\225\27\14J\320\205\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\3\226\26"
-  "\15B\260\215\203\212\203R\321\311M\225N.Uz\360\240\0\3\227\16\14J\20\6A~x\360!\77"
-  "\24\3\230\42\17F\60\246\273\203\241\61\231A\21ISZ\222\23\222\23\332R\11\311\11I\31\271\241\203"
-  "\261#\0\3\231\11\2J\320\204\37\20\3\232$\14J\320\5\271\262\11\251\21\241\31\231!\221)\211\261"
-  "+\12\251\221!\241\31)\31\61\21\261\11\271B\1\3\233\42\16B\320\265\331Q\211P\11I\11A\31"
-  "\71\31\61!\61)\215\304f\344D\346D\4'$I\5\3\234-\17JP\206I\313\273\203\270\203\60"
-  "\11\12)\11\12\251\20\12!\21\22\31\21\22\231\30\22\65\64\22\62\64\22A\64DDCDR\2\3"
-  "\235\36\14J\20\6\301\272:\263+\12)\22!\222\31\32\31\42\21\242\11*\11\62w\205\2\3\236\23"
-  "\14F\320\205\17\346qq\60r\60\217\213\203\7\3\3\237\36\17F\60\246\273\203\241\261\221A\21IS"
-  "ZnK%$'\6e\306\206\16\306\216\0\3\240\15\14J\20\206\17\12\371\377P\0\3\241\30\14J"
-  "\320\205\3\231\3\12\71\11\271Bve\23\7#W\242z\12\3\243\24\13J\260\205\203\211\203\11Q="
-  "\234[\250\345\301\203\0\3\244\16\14F\260\205\17\246D\365\377\12\0\3\245\32\16B\320\205I\211\271\21"
-  "\71\231)\251\231\61\31\271\11\311\322Ya}\6\3\246'\60\306/>q\321\203)\12\11\32!\231\211"
-  "!\25RBURTRTBFJfdf\16\252\16d\305\325\1\3\247\42\16B\320\215A\21\71"
-  "!)\251\231\61\31A\11I\332\245\22\202\23c\63bRBb#s\226\2\3\250$\20FP\6)"
-  ")*)*)*)*\251\42)\11!)\11!\241\211\31\231\231\203\262\3Qq\335\1\3\251$\17"
-  "F\20\246\273\3\251\65s#\222\22\223\22\242\22\242\22\242\22\223\42\222\42\202BrRjL\16L\16"
-  "\3\252\17fB\320\4\21\22A!\375\377\4\0\3\253\37nB\320%\21A\21y\230I\211\271\21\71"
-  "\231)\251\231\61\31\271\11\311\322Ya}\6\3\254\42\13F\220\255A\365@\63\22\27\212&\304$\304"
-  "$\304$\304$\304$\304$\206FF$DJ\4\3\255\30\10F\60\245)\325\64\27\62\21rbD"
-  "\64Sbr\42\23\26\0\3\256\25\211J\216\245\61\325!$\21\26\63UTc\373LN\7\3\257\15"
-  "\4F\220\214\11e\42\372\237\0\3\260\30\12F\220-!\11%\22!\262b\374\231\204\224\204\220\310\32"
-  "\23\0\3\261\37\213E\220\235\31\211\13E\23b\22b\22b\22b\22b\22b\22C##\22\42%"
-  "\2\3\262%\212J\216\225\32\212\21)\11)\211\60\211\260\220\240\221\20\232\250\211\60\211\70\62V\22\63"
-  "\23\21&\221Y\2\3\263\34\13Bn\5\71\11)\21)\21)\31E\62R\61R\22b\22r\203+"
-  "u\4\3\264\35\13F\220\215\3\221\3\31\321\311\61\243\31\221)\11\61\11\71\316$\246D\26\331\0\3"
-  "\265\26\210E\60\25\232\13\231\10\71\61\42\232)\61\71\221\11\13\0\3\266\25\251\306-\225\23\63\275\23"
-  "\223\323\303*;\301\70\61\65\0\3\267\23\11J\216\205\20\222\10\213\231*\252\261}&\247\3\3\270\33"
-  "\12F\220\235\242\211\21!\21)\62f\7\17\306\230IHI\10\211,*\1\3\271\11\202E\220\204\17"
-  "\6\3\272\32\212Ep\5\251\242\11\31%B\22RUF\42B\62\212D\204&\244\6\3\273\36\13B"
-  "p\35IQI\311\301ue\22b\22R\62B\62B\62#R\42R\22c\2\3\274\17\11J\216\5"
-  ")\376\243\203\7r\332\1\3\275\33\213Ap\5\71\11)\21)\21)\31E\62R\61R\22b\22r"
-  "\203\213\0\3\276\32\251\306-\225\32*\271@\71+\42\61u\332\315\225\325\11\212IQ\311\0\3\277\31"
-  "\213E\220\35\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\3\300\36\217A\360\205\37\10E"
-  "\311E\311E\311E\311E\311E\311E\311E\311E\311E\311\0\3\301\31\13F\216\245\261\233%R\42"
-  "bt\354\312\252$J&$j$\265\4\3\302\25)\306M-\32\213\61u:\234+#\224\23\233)"
-  "\232\1\3\303\37\214E\260\235\3\221\203\11!\31\61\21\61\21\71\11\71\11\61\21\61\221)\231\221)#"
-  "\0\3\304\15\210A\20\205\7Bq\371\67\0\3\305\22\212E\220\5\61\376LBJBHd\215\11\0"
-  "\3\306\42\15F\316\235\20\242\221\32\21\31\11\31\25\62B\64B\64B\64*d\224ht e)\253"
-  "\31\0\3\307 \12Fn\5\61\62\11!\21!\31\21!\21)\262A\71*\11)\21\31\215$\244$"
-  "\304\4\3\310&\16F\356\5!!\42!\42!\42!\42!\42!\42\241\10!\241\10!\31\21\31%"
-  "\24\22S\7\221\302\232\1\3\311 \217E\60\26A\21I\21Q*!*!*!*!*!*\241"
-  "\232!\211\11%\62L\0\3\312\17\7>\220\204\221\22y\10)\375o\0\3\313\26\12F\220\25E\42"
-  "\362pb\374\231\204\224\204\220\310\32\23\0\3\314\34\13F\220\255A\365@d\67B\23b\22b\22r"
-  "\314$\304$\246D\26\331\0\3\315\25\12F\220-A\71q\61\376LBJBHd\215\11\0\3\316"
-  "#\17F\60Faiy@%\222\42\242TBTBTBTBTBTB\65C\22\23Jd\230"
-  "\0\4\1\34lJ\320\225\211\251\211y\200\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\4\2)"
-  "\21Fp\206\203\252\203Ry\0y\0y\0y\0\211\273\3\62\271)A)A)A)A)\271)"
-  "\231\10\62\231\22\0\4\3\20\212J\220\245\71\365\0\37\4\352\377!\0\4\4!\16F\360\245\263\3\241"
-  "\251\221\271\11\311Z\341\203\260\203\60\341aI\211\271\21\261\241\3\261\33\0\4\5\36\15F\320\235\253\3"
-  "\31\261\21\71\21\71\21\331\322C\333\331\312\272\11\71\221\203\251\33\0\4\6\11\2J\320\204\37\20\4\7"
-  "\17fB\320\4\21\22A!\375\377\4\0\4\10\17\10Fp\65\375gD\214\16&,\0\4\11\61\27"
-  "B\360\236\203\351\203i\61i\61i\61i\61i\61i\261\3\61\261\3\42\61\71!\61\271\31\61\271\31"
-  "\61\271\31\61\71\11\272\3\12\272\3\31\0\4\12.\24J\320\6\61Q\61Q\61Q\61Q\61Q\61Q"
-  "\61\321\203\203\231\203\203\12\61\71\11\61\271\62\271\62\271\62\71\11\261\203\21\261\3\31\0\4\13'\21F"
-  "P\206\203\252\203Ry\0y\0y\0y\0\211\273\3\62\71\61A)A)A)A)A)A)"
-  "A\1\4\14&\213J\220-\301Ay\10\261*#\31!\31E\62B\42ReV\42C\62B\62\63"
-  "B#R\42R\23b\3\4\16&\216B\320%\31\301\230\310z\30Q\11A\221\71\31\61)\215\344d"
-  "\344d\42%$%Dgg\205\5+\11\1\4\17\21\214J\356\5A\376\77<xP%\252\25\0\4"
-  "\20$\17B\320\265\341YZ\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31\301\21I"
-  "\11\321\1\4\21\35\14J\320\205\203\221\203\21Q\235\36\214\34P\310I\310\25\322\325I\34P\34\310\0"
-  "\4\22#\14J\320\205\203\240\203\21\61\21\71\11\71\11\71\11\251\221\3\231\203\21\71\11\271\356$\16F"
-  "\16d\0\4\23\15\12J\220\205\17\2\365\377\20\0\4\24(\216B\356\235\203\241\203!\61!\61!\61"
-  "!\61!\61!\61!\61!\61!\61\31\71\31\71\31\71\211\203\17D\71\25\4\25\27\14J\320\205\3"
-  "\212\3\12Q\235\36P\34P\210\352\364\340\301\0\4\26\60\24B\220\206\61\261+)\32!)E\352d"
-  "\204\344dT\212\210\214\36\210\36L\216\310\310\315\310\214\11\11-\222\22\222\222\32\231\22\223\30\223\23\4"
-  "\27\37\14F\260\35\243\3\31)\221\61\11\71\311\301\261:\323Q\11\271:\21\251\221\3)\33\0\4\30"
-  "\35\14J\360\5A\272fVG\23D\42\64#$\63$B\24CWffu\204\2\4\31#\214J"
-  "\360\235\240\60\21\71z\10A\272fVG\23D\42\64#$\63$B\24CWffu\204\2\4\32"
-  "\42\13J\220\5\261*#\31!\31E\62B\42ReV\42C\62B\62\63B#R\42R\23b\3"
-  "\4\33%\15B\320\235\203\231\203\31\61\31\61\31\61\31\61\31\61\31\61\31\61\31\61\31\61\31\61\31\61"
-  "\31\261\63;\1\4\34-\17JP\206I\313\273\203\270\203\60\11\12)\11\12\251\20\12!\21\22\31\21"
-  "\22\231\30\22\65\64\22\62\64\22A\64DDCDR\2\4\35\16\14J\20\6A~x\360!\77\24"
-  "\4\36\36\17F\60\246\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\4\37"
-  "\15\14J\360\205\17\12\371\377P\0\4 \30\14J\320\205\3\231\3\12\71\11\271Bve\23\7#W"
-  "\242z\12\4!\35\16F\20\246\263\3\241\251\21\301\11\311Za\215\207%%\4G\304f\16\306n\0"
-  "\4\42\16\14F\260\205\17\246D\365\377\12\0\4# \16B\320\5Q\11A\221\71\31\61)\215\344d"
-  "\344d\42%$%Dgg\205\5+\11\1\4$&\17F\20\66i\331\263\3\232\21\231\211\31!\11"
-  "!)\42)\42)\42\251\32!\221\21\231\231\3\262Si\71\0\4%\42\16B\320\215A\21\71!)"
-  "\251\231\61\31A\11I\332\245\22\202\23c\63bRBb#s\226\2\4&&\216J\16\6A\21A"
-  "\21A\21A\21A\21A\21A\21A\21A\21A\21A\21A\21A\21A\221\203\217u\4'\23\14"
-  "F\320\5A~X'\61Dr\60\64#\252\7\4(&\21J\220\6)\61*\61*\61*\61*\61"
-  "*\61*\61*\61*\61*\61*\61*\61*\61*\261\203\37\4\4)<\222J\216\6)\61\11)"
-  "\61\11)\61\11)\61\11)\61\11)\61\11)\61\11)\61\11)\61\11)\61\11)\61\11)\61\11"
-  ")\61\11)\61\211\203\37\304C\310C\310C\310C\10\4*'\21B\60\206\323{\0y\0y\0y"
-  "\0y\0y\200\203\271\3\62\71\61\271)A)\271)\71\261\3\262\3\31\0\4+\34\20Jp\6a"
-  "~|Pt`C'C\67B(B\67B's`s@%\4,\31\14J\320\5Q}z\60r"
-  "@!'!WHW'q@q \3\4-!\16F\360\235\263\3\241\61\221A\11I\341a\261\203"
-  "\260\203`\331J\211A\221\61\241\203\251#\0\4..\23J\320\6\71#\261\3\21)\261\11!A\11"
-  "\231I\32Q\32\321\3\321\3Q\32Q\32Q\232I\42A\11)\261\11\251\203\21\71#\0\4/%\15"
-  "F\20\236\203\221\3\212\71\11A\11A\11A\211\71\221\3\242\3\241!\231)\221\61\21\71\211\271BJ"
-  "\1\4\60\27\212E\220\235\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\4\61\35\13F\220\235\203"
-  "\220\203\20\311H\231(\11\23\232\211)\11\71\236MH\311\250\252\1\4\62\34\212Ep\5\243\3\11)"
-  "\11)\11)\211\3\211\3\11\251\62\262\3\212\203\20\0\4\63\14\207E\20\205\7R\372W\0\4\64\35"
-  "\354\301\216\235\203\240\203 \35E\11E\11E\311H\311H\311\204I\34<\250\134\31\4\65\26\212E\220"
-  "\35\252\23\241\62\262\203\7\203bU\22#\63&\0\4\66%\217A\320\205(\251\210\31!\31\21\31\251"
-  "\20\231\60\11\21\271\303;\11\21)\21\31\231\21\31\215$\204\204\6\4\67\25\210EP\25\32\13!\42"
-  "\61\31\242\62\61\242\222\11\13\0\4\70\30\212E\220\5\61\252F\66\22\64\22$\42$\61\24\62FU"
-  "U\2\4\71\35\12F\220\25\31!\11\261i\61\252F\66\22\64\22$\42$\61\24\62FUU\2\4"
-  ":\33\211E\60\5\71!\11\31\21\231\30\21\231\242\42\21\31%\62\42B\22B\3\4;\34\213A\220"
-  "\225\3\221\3\21\261\20\261\20\261\20\261\20\261\20\261\20\261\20\261f\1\4<\35\214I\360\205\61W\25"
-  "B\25\62\22\23\62\22#\42!#\22\42#\22\42\63{#\4=\17\212E\220\5\61\236\35<\30\343"
-  "\231\0\4>\31\213E\220\35\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\4\77\14\212E"
-  "\220\205\17\302\370\317\4\4@\30\12F\216\5\221\31\11\13\32+\62\316\252\252L&$J\4\65\4\4"
-  "A\23\212Ep\35\252\23!\11\61B\235\25\211\254\61\1\4B\15\212AP\205\7F\202\372G\0\4"
-  "C!+\302m\5\71\11\61\11)\31!\31E\62R\42R\22b\22rt\223\222\221\202c\204r\0"
-  "\4D'\220FN>qM'Df\16Ndh\252\244\250\244\250\244\250\244\250\244\250\244\212\206$F"
-  "Jd.(\305\265\3\4E\32\213Ap\205\251\211!\31U\22bu\203se\22R\62\62C\42R"
-  "\3\4F\37\353\305\216\5\61\11\61\11\61\11\61\11\61\11\61\11\61\11\61\11\61\11\61\211\203\7\221\32"
-  "\4G\17\211Ep\5)\276\222\70\10\271\323\1\4H\36\216I\60\206(\241)\241)\241)\241)\241"
-  ")\241)\241)\241)\241)\241\203\17\4\4I)\360\311N\206(!\221(!\221(!\221(!\221"
-  "(!\221(!\221(!\221(!\221(!\221(!\221\203\17\310\65\4J\26\215A\260\5;[m"
-  "\317\16\242\24I\11I\11\35D\235\0\4K\30\214I\360\205\310]\36\310\34\214\214I\214I\214I\34"
-  "\214\34\310\10\4L\24\212Ep\5A\35\36\204\34H\210\61;\240\70\10\1\4M\31\212Ep\25\252"
-  "\23\241\11)A!\243;\11)\11)\21\221\241\32\0\4N#\217E\20\6\61\32\241\23!\25\62R"
-  "\22\62b\7b\7b\64b\64R\65C\22B#\23R&\0\4O\27\212E\220%\213\203*\62\262"
-  "*\211\3\231\23!\11\251*\62\1\4Q\32\12F\220\25E\42\362\240T'Bed\7\17\6\305\252"
-  "$FfL\0\4R'\253\302\215\15\301\243+I\21\32\11\23\232\211)\11\61\11\61\11\61\11\61\11"
-  "\61\11\61\11\61\11\61I\355\6E\0\4S\20\7F\20%\241!\311\203\3)\375+\0\4T\26\212"
-  "Ep\35\252\23!\11\61B##A\261\42\221\65&\0\4U\25\211Ep\25\242\13\241\252\210\271\262"
-  "\272*\252\232\211\13\0\4V\13\2F\220\4\242\203\7\3\4W\16\6B\320\4\21\22q!\375O\0"
-  "\4X\16\244\276\215\24\245\42\372\177r \1\4Y$\223A\220\236\3\321\3\321\60\321\60\321\60\321\260"
-  "\253\260\3\231\60)\231\60)\21\61\251\11\261\3\263\23\0\4Z!\220EP\6)\71)\71)\71)"
-  "\71)\271\3\233\203\203\10))*)*)\252\3\252\23\0\4[#\13B\220\15\301\243+I\21\32"
-  "\11\23\232\211)\11\61\11\61\11\61\11\61\11\61\11\61\11\61\11\61\1\4\134\36\11F\60%\261\61i"
-  "\71!\11\31\21\231\30\21\231\242\42\21\31%\62\42B\22B\3\4^'\253\302m\235\30)\11\271y"
-  "\0\71\11\61\11)\31!\31E\62R\42R\22b\22rt\223\222\221\202c\204r\0\4_\20\352\305"
-  "\216\5\61\376\263\203\7A\202\212\0\4\220\17\210JP\65\315\16\16\314\364\377\14\0\4\221\16\7F\60"
-  "\265\314\16\16\246\364\257\0\4\222\25\14B\220\225\203\221\203\21Q\35\36\4\35\204\211\352C\0\4\223\17"
-  "\210A\20\215\27b\252l\304\364\12\0\4\226\67\224B\216\206\61\261+)\32!)E\352d\204\344d"
-  "T\212\210\214\36\210\36L\216\310\310\315\310\214\11\11-\222\22\222\222\32\231\22\63\223\223\7\212\7\212\7"
-  "\212\7\12\4\227$\357\301\316\205(\271\31!\31\21\31\251\20\231\60\11\21\271\303;\11\21)\21\31\231"
-  "\21\31\215\212\204\246\65\4\232\42\213J\216\5\261*#\31!\31E\62B\42ReV\42C\62B\62"
-  "\63B#R\42Rf\223:\4\233\33\351\305.\5\71!\11\31\21\231\30\21\231\242\42\21\31%\62\42"
-  "BEs\32\4\234)\13J\220\5\261*#\31\211\20\31\211\10!\211\10!\211\251\62+\11\42\211\10"
-  "!\211\210\31\211\220\21)\21\251\11\261\1\4\235\37\211E\60\5\71!\11\211\10\21\211\64\22\63EE"
-  "\22\63\22\21\42\22\21\42B\22B\3\4\242'\216J\16\6A\21A\21A\21A\21A\21A\21A"
-  "\221\203\222\203\22A\21A\21A\21A\21A\21ACb\35\4\243\37\353\305\216\5\61\11\61\11\61\11"
-  "\61\11\61\211\203\211\203\11\61\11\61\11\61\11\261\262I\15\4\256\32\14B\220\5A\11\61\21\61\31!"
-  "\241\31)\21\71\11\71\312IQ}\5\4\257\35\13Bn\5\71\11\251\11)\21)\31E\62R\61R"
-  "\22b\22r\21\201+u\4\4\260\33\14B\220\5A\11\61\21\61\31!\241\31)\21\71\11\71\252\3"
-  "*Q}\5\4\261 \13Bn\5\71\11\251\11)\21)\31E\62R\61R\22b\22r\21\201\253\16"
-  "\304$\25\1\4\262\42\217B\316\215A\31\71)e\63s\62\222\22\242\304k%$'\346f\344\244\224"
-  "\315\314]N\353\0\4\263\33\353\301n\205\251\211!\31U\22bu\203se\22R\62\62C\23R\223"
-  "\32\4\270\37\14F\320\5A\336\310\320\310\320\310\224\310HLH\220\34\14\315H\311H\311H\311\210*"
-  "\4\271\27\211Ep\5)NBHBHB$\16B\216B\204B\344\24\4\272\23\14J\320\5Q="
-  "\22:\30!\232\220+\344\207\2\4\273\21\212Ep\5A\35\36H\14I\210\361L\0\4\330\36\17F"
-  "\20\246\273\3\251\65s#\222\322\322\7\77-\25\221\24\21\234\21\33:\230;\2\4\331\32\213E\220\35"
-  "\252\203\30\241\11\61I\321\203\203\60\11\61\21)\221E\66\0\4\350 \17F\60\246\273\203\241\261\221A"
-  "\21IS\332\203\17li%$'$e\344\206\16\306\216\0\4\351\32\213E\220\35\262\33\241\11\61\11"
-  "\61\211\203\7c\22b\22S\42\213l\0\5\260\12\202\314\355\4\221\11\0\5\261\15\207\300\355\4\11\312"
-  "\20\221\230\0\5\262\13\206\304\355\204\11Q!\1\5\263\14\206\304\355\204\11\211@!\1\5\264\11BL"
-  "\356\204\10\1\5\265\12ED\356\214\10\12\1\5\266\14\205\304\355\4\11\71\231\20\0\5\267\10$\310\356"
-  "\4\2\5\270\13d\310\355\4\212\230\20\0\5\271\11B\314\366\204\10\1\5\273\14\207\300\355\4A\251\10"
-  "\261\0\5\274\11B\314\362\204\11\0\5\275\10\201\314\355\4\2\5\276\11FD\25\205\203\2\5\277\10$"
-  "H\367\4\2\5\300\10\302I\320\204\37\5\301\10B\340\366\214\1\5\302\10B\264\366\214\1\5\303\11\202"
-  "I\320\4s\2\5\320\37\213E\220\205)\21)\31!\231\31\31\212\221\12\31\11\42\221!\31\231!\21"
-  "\251\11\261\1\5\321\20\213E\220\205\262\313I\311I=\71x\20\5\322\20\207E\20\215!\252)\275!"
-  "\221PC#\5\323\15\213Ap\205\17\342$\365O\0\5\324\20\212I\260\215\242\203\300AIA\62>"
-  "\23\5\325\11\202I\260\204\17\6\5\326\17\207E\20\205\67BRBbRz\3\5\327\21\212I\260\215"
-  "\242\203\20\241\11\251\62\376L\0\5\330\25\212I\260\5!\21\221\12\221\20\11\61~%\262\306\4\0\5"
-  "\331\11\302H\263\204\203\2\5\332\16\11Fn\5\252\273\71A\71\375\17\5\333\17\210EP\5\42\263e"
-  "z%qQ\3\5\334\23\10FP\5\61\315\16\16\304t%\65%\246\11\0\5\335\22\212I\260\215\242"
-  "\203\20\241\11\251\62>;x\20\5\336\37\213E\260\5!\31\221\32\32\221!\221)\21)\11\61\11\61"
-  "\11\61\11\61\11\221\203\30\3\5\337\11\2J\256\204\37\20\5\340\15\205E\360\204\21\232\31}sP\5"
-  "\341\27\213E\220\35\262\233\25S\22bu\314\254D\244D(\206l\0\5\342\32\252\301o\215!\21!"
-  "\21!\21!\21!\221\31}\42$\61Tb\64\7\5\343\24\12F\216\25\242\3\11\241\11\61fU\22"
-  "\64\202\372\3\5\344\27\212E\220\25\242\203\20\241\11\251\262*\11\32A\271\261\221\67\0\5\345\30\11B"
-  "N\5)\11!\11!\21\31\21\31\25\63Ucr\372\15\0\5\346\31\211AP\5)\11!\211\31\21"
-  "\31%\62Usrs\42\7\21\7\1\5\347\31\11J\216\205\7t\332\21I\310L\310\210\310\210\210\214"
-  "\210\214\310i\7\5\350\16\211Ep\205\242\273\71A\71\375\0\5\351 \215E\360\5!\31\42\31\42\31"
-  "\232\31\32!\32\241\3!\11\252\11\71\221\251\31\12\252\33\0\5\352\35\215A\320\235\262\203)\241!)"
-  "!\61\31\61\31\61\31\61\31\61\31\61\11\262\63\1\5\360\13\207IP\5\31\376o\4\5\361\14\207I"
-  "P\5\31\276\221\322\7\5\362\12\307HS\5\31\276\21\5\363\14\243\304\263\14\25\21\22!\0\5\364\22"
-  "\247\304\63\15\21\11\21\211\230\10\21\211\230\20\0\6\14\13\303H\362\214$!\26\2\6\33\16CI\362"
-  "\214$!\7B\21\23\2\6\37\24\246\305\361\224\11\231\21\12\213\210!)\251P!%\0\6!\20\347"
-  "D\61\35\241\231(\241\203\220\241 \0\6\42\20\343\305\221\204\241\220|\42\241EH\4\0\6#\21\3"
-  "F\222\4\221\231\220|\42\241EH\4\0\6$\31\311E/%\271@\321\270\261\210\260\210\260\71\301\70"
-  "\61\211\230\231\32\0\6%\22CF\217\214\220|\42\241EH\234D\210\4\0\6&\34\254\305\317\215P"
-  "\321\300A\212\250\240\260\240\260\240\60S\311\210\60\212\203\31+\0\6'\15\242\311\221\204\210|q \21"
-  "\1\6(\32p\305\357\215\340\210\350\210h\352\10\341\210\203\203\230\3{\224\362\0q\0\6)\23f\301"
-  "\321\34\11\215\243\204(B$b\42*(\0\6*\32p\305\361E\341\10\331y\320\340\210\350\210h\352"
-  "\10\341\210\203\203\230\3\3\6+\36\260\305\361\265x\0y\200\341\10\331y\320\340\210\350\210h\352\10\341"
-  "\210\203\203\230\3\3\6,\32\352\305\215\225\251\203\22\33\271\300D\211d\242b\42#%\351\16\242F\0"
-  "\6-\25\352\305\215\225\251\203\22\33\271\300\224\271\224\244;\210\32\1\6.\30j\306\215%Ay\330\251"
-  "\203\22\33\271\300\224\271\224\244;\210\32\1\6/\14&\311\361\234(UY\35\30\6\60\20\306\311\361\214"
-  "(\251x\230(UY\35\30\6\61\21j\311O=\311H\311\14\345\224\304\14\25\1\6\62\24\12JO"
-  "\65Ay\224\222\221\222\31\312)\211\31*\2\6\63!rEO\326x\220\230\220\210\300\230\220\210\300\30"
-  "\11\321\203\320\221\311\70\301@\241\311\203\350Y\0\6\64+RFO\356x\20y\230x\200\10iy\254"
-  "\342AbB\42\2cB\42\2c$D\17BG&\343\4\3\205&\17\242g\1\6\65#xE\17"
-  "\327@\332\260\213\300(!\211\300\30\261\321\203\323\203\313h\301p\241y\200\203x\240y\20\0\6\66("
-  "\370E\17\177\200x\270y\134\5\322\206]\4F\11I\4\306\210\215\36\234\36\134F\13\206\13\315\3\34"
-  "\304\3\315\203\0\6\67\26\316A\222%\331a\341\360\350\334\220E\230I\11\305\35| \6\70\31\316A"
-  "\222%\331a\341\240\310\20\311\350l\310\42\314\244\204\342\16>\20\6\71\32+\302\215\235\261\262\320\270\20"
-  "\231\231\263\71A\311\244\241*\11\17\244H\0\6:\35\253\302\215\35Iy\24ce\241q!\62\63g"
-  "s\202\222ICU\22\36H\221\0\6@\11E\300\221\204\203\1\6A\30\221\305\61ny\0y\314\42"
-  "\242\211\213C\204o'\16\16d\16\16\6B\35,J\217E\301\10Ayd\222\204!\21a!cv"
-  "\22\242*\213H\16\244\250\0\6C\37\315\305\261\325\340\321\301\220\300\230\270\240\270\221\310\220\210\60\31\231"
-  ")\331\321\210\203\222\3\2\6D\25*Jp\275\310\271\301\310L#\342\4u\70uPS\3\6E\22"
-  "\207\305\355\34!\62\221\212\203\250\260\270\260\254\0\6F\22\312Io%\311x\300HA=\34:\60\32"
-  "\2\6G\16\305D\322\14\231\211\220\231\203\11\0\6H\26iE/\275\270\261\210\260\210\260\71\301\70\61"
-  "\211\230\231\32\0\6I\31l\305\317\315A\212\250\240\260\240\260\240\60S\311\210\60\212\203\31+\0\6J"
-  "\36\314\305\315\315A\212\250\240\260\240\260\240\60S\311\210\60\212\203\31\333\310\10\271\211 \0\6K\12\203"
-  "\304\226\214\231\21\0\6L\14\244\304\266\234\220\211\11\22\0\6M\11\203\304\216\224%\0\6N\11C\304"
-  "\227\224\11\0\6O\15\244\304\226\224\20\31\211\220\30\0\6P\10#\304\220\204\1\6Q\14\204\304\226\234"
-  "\210\10\212\30\0\6R\13\203\304v\4\211\210\22\0\6`\13\243\320r\215\220\203\220\0\6a\17\244\315"
-  "q\215\230\220\21\31\21\231\374\0\6b\23\247\311q\205\250\241\203\210\232!\261\60)\261\234\0\6c\26"
-  "\211\305q\265\230\30\211\203\11\212\221@\301\204\202q\201Q\0\6d\24\246\315q\245D\62A\63%C"
-  "QAQ$%\23\0\6e\22\10\311r\35)\232\220\211\250\61\61\22\11\23\0\6f\17gIr\5"
-  "\213\222\262\314\244\304\244\24\6g\26iEr\215\260\210\60\42\211\231\30\221\250\220\250\71\355\202\0\6h"
-  "\30hIr\235\270\260\210\250\210\250\10\241\10\231\30\221\230\242\251\261\0\6i\23\247\311q\225\231\222\20"
-  "\211\240\10\223\262\234I\211\5\6j\32\350Iq\205!\232\220\240\260\270\260\270\260\270\260\270\260\270\240\210"
-  " \242\1\6k\13\243\310\360\214\12\25\21\0\6m\23\347Hu\215L&b\42B(DH\42\22\305"
-  "\0\6q\15\313M\20\206\203J\375/\17\12\6~\36\320E\356\215\340\210\350\210h\352\10\341\210\203\203"
-  "\230\3{\264*\242\343!\344\1\302\0\6\206\37\352\305\215\225\251\203\22\33\271\300\240\230\24\42!\23!"
-  "Q\61A#\221\222t\7Q#\0\6\230\30JJO-AQ\261\10)y\24\222\221\222\31\312)\211"
-  "\31*\2\6\244\15\313M\20\206\203J\375/\17\12\6\251\37\262\305Q~\0\351\342qy\10y\210y"
-  "\210\241`\231h\221p\11\361\203\3\223\203\3\1\6\257#\22\306Q~\0q\342q\31\351\342qy\10"
-  "y\210y\210\241`\231h\221p\11\361\203\3\223\203\3\1\6\314\31l\305\317\315A\212\250\240\260\240\260"
-  "\240\60S\311\210\60\212\203\31+\0\6\325\16\305D\322\14\231\211\220\231\203\11\0\6\360\13\243\320r\215"
-  "\220\203\220\0\6\361\17\244\315q\215\230\220\21\31\21\231\374\0\6\362\23\247\311q\205\250\241\203\210\232!"
-  "\261\60)\261\234\0\6\363\26\211\305q\265\230\30\211\203\11\212\221@\301\204\202q\201Q\0\6\364\27\210"
-  "\311q\205\230\211\20\31\211\240\241\10\223\242\70\61\271dQ\0\6\365\26\210Ir\235\70\61\71\241\222\30"
-  "\221\240\210\60e\7\21\27\0\6\366\25\210\311q\35)\232\270\250\203\210#\261\60\261\270\260\60\0\6\367"
-  "\26iEr\215\260\210\60\42\211\231\30\221\250\220\250\71\355\202\0\6\370\30hIr\235\270\260\210\250\210"
-  "\250\10\241\10\231\30\221\230\242\251\261\0\6\371\23\247\311q\225\231\222\20\211\240\10\223\262\234I\211\5\36"
-  "\200B\225B\220\306y y(y\4cs\22bc\42b\21a\42R\22R\42R\22R\62B\22"
-  "Bj\64\222\321HFM\230HT\210\230\204\224\204\230\204\224\204\134\204\224D`D\334\340\334\340\234\24"
-  "\0\36\201/\20B\20\256qy\0y@))*\25\62\64\42\62\64\42\62\64\62IB\204$D$"
-  "\204$D$\244\42D$\302\206\306\206\306\206\204\0\36\202B\225B\220^y\30y y\4cs\22"
-  "bc\42b\21a\42R\22R\42R\22R\62B\22Bj\64\222\321HFM\230HT\210\230\204\224"
-  "\204\230\204\224\204\134\204\224D`D\334\340\334\340\234\24\0\36\203.\20B\20Fi\361xH))*"
-  "\25\62\64\42\62\64\42\62\64\62IB\204$D$\204$D$\244\42D$\302\206\306\206\306\206\204\0"
-  "\36\204BuB\220>\21y\0\21y\360\261\71\11\261\61\21\261\210\60\21)\11)\21)\11)\31!"
-  "\11!\65\32\311h$\243&L$*DLBJBLBJB.BJ\42\60\42npnpN"
-  "\12\0\36\205/\20B\20.\21Q\21ytRRT*dhDdhDdhd\222\204\10I\210"
-  "H\10I\210HHE\210H\204\15\215\15\215\15\11\1\36\240(\217B\316\265\341YZ\11I\21I\221"
-  "A\31\71!\71)\251\203\251\3\42\71\31A\31\301\21I\11\321y\60iu\0\36\241\32\12F\216\235"
-  "\232\203\20\241\62A\231\13\213*\62*\33\12\13qAE\0\36\242(\217B\320-ra\351\350\341Y"
-  "Z\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31\301\21I\11\321\1\36\243\34*F"
-  "\220\35JA\271x\220\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\36\244)\217B\320=a\351"
-  "Q\21\331\341YZ\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31\301\21I\11\321\1"
-  "\36\245\37\212F\220\255\71\365\60rT\42\362\0\65\7!Be\202\62\27\26UdT\66\24\26\2\36"
-  "\246)\217B\320-q\351Q\21\331\341YZ\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31"
-  "A\31\301\21I\11\321\1\36\247 \212F\220\225AIy\30\71*\21y\200\232\203\20\241\62A\231\13"
-  "\213*\62*\33\12\13\1\36\250)\217B\320-j\341Q\21\331\341YZ\11I\21I\221A\31\71!"
-  "\71)\251\203\251\3\42\71\31A\31\301\21I\11\321\1\36\251 \212F\220\35J\261\71A\71*\21y"
-  "\200\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\36\252+\217B\320\245\231\300\220\331Q\21\331\341"
-  "YZ\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31\301\21I\11\321\1\36\253!j"
-  "F\220\25\12\231\220y\10\71*\21y\200\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\36\254+"
-  "\317B\316\265Q\21\331\341YZ\11I\21I\221A\31\71!\71)\251\203\251\3\42\71\31A\31\301\21"
-  "I\11\321y\60iu\0\36\255\37\212F\216%\71*\21y\200\232\203\20\241\62A\231\13\213*\62*"
-  "\33\12\13qAE\0\36\256(\217B\320=a\331\240P\342\265\264\22\222\42\222\42\203\62rBrR"
-  "R\7S\7Dr\62\202\62\202#\222\22\242\3\36\257 \212F\220\255\71\365\20\62B\22b\363\20\65"
-  "\7!Be\202\62\27\26UdT\66\24\26\2\36\260(\217B\320-q\331\240P\342\265\264\22\222\42"
-  "\222\42\203\62rBrRR\7S\7Dr\62\202\62\202#\222\22\242\3\36\261!\212F\220\35IA"
-  "y\10\31!\11\261y\210\232\203\20\241\62A\231\13\213*\62*\33\12\13\1\36\262(\217B\320-j"
-  "\321\240P\342\265\264\22\222\42\222\42\203\62rBrRR\7S\7Dr\62\202\62\202#\222\22\242\3"
-  "\36\263!\212F\220\35J\271\271\60\31!\11\261y\210\232\203\20\241\62A\231\13\213*\62*\33\12\13"
-  "\1\36\264*\217B\320\255\221\300\20\302\240P\342\265\264\22\222\42\222\42\203\62rBrRR\7S\7"
-  "Dr\62\202\62\202#\222\22\242\3\36\265!jF\220\25\12\31\11j\31!\11\261y\210\232\203\20\241"
-  "\62A\231\13\213*\62*\33\12\13\1\36\266)\317B\316\245\244\304ki%$E$E\6e\344\204"
-  "\344\244\244\16\246\16\210\344d\4e\4G$%D\347\301\244\325\1\36\267 \212F\216\25\31!\11\261"
-  "y\210\232\203\20\241\62A\231\13\213*\62*\33\12\13qAE\0\36\270\33\214J\316\205\3\212\3\12"
-  "Q\235\36P\34P\210\352\364\340\301<\210\250*\0\36\271\31\12F\216\35\252\23\241\62\262\203\7\203b"
-  "U\22#\63\366\20\202\212\0\36\272\33\214J\320\245Y\311\311\260\3\212\3\12Q\235\36P\34P\210\352"
-  "\364\340\301\0\36\273\33*F\220\35\302A\271x\20\252\23\241\62\262\203\7\203bU\22#\63&\0\36"
-  "\274\35\214J\320\245\230\250+\21y\210\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\36\275\34\12"
-  "F\220\35\21\231\233\30y\0\252\23\241\62\262\203\7\203bU\22#\63&\0\36\276\34\214J\320\65\311"
-  "\320\71\31\231\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\36\277\36\212F\220\255\71\365\60cT"
-  "\42\362\0T'Bed\7\17\6\305\252$FfL\0\36\300\34\214J\320\35\341\320\71\31\231\3\212"
-  "\3\12Q\235\36P\34P\210\352\364\340\301\0\36\301\37\212F\220\225AIy\230\61*\21y\0\252\23"
-  "\241\62\262\203\7\203bU\22#\63&\0\36\302\34\214J\320\35\322\301\71\31\231\3\212\3\12Q\235\36"
-  "P\34P\210\352\364\340\301\0\36\303\37\212F\220\35J\261\71\301\61*\21y\0\252\23\241\62\262\203\7"
-  "\203bU\22#\63&\0\36\304\36\214J\320\235\221\250\20\272\71\31\231\3\212\3\12Q\235\36P\34P"
-  "\210\352\364\340\301\0\36\305 jF\220\25\12\231\220y\210\61*\21y\0\252\23\241\62\262\203\7\203b"
-  "U\22#\63&\0\36\306\36\314J\316\245\71\31\231\3\212\3\12Q\235\36P\34P\210\352\364\340\301<"
-  "\210\250*\0\36\307\36\212F\216\245\61*\21y\0\252\23\241\62\262\203\7\203bU\22#\63\366\20\202"
-  "\212\0\36\310\17\205F\320\4\42\21\231\30\375\377\11\0\36\311\17%B\220\4\42\31\221@\31\375O\0"
-  "\36\312\12\202J\316\204\37\220\30\36\313\16\203F\216\4\11\71\11\375\217\16\4\36\314!\217F.\246\273"
-  "\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\356A\207\227\1\36\315\34\13F\216\35"
-  "\262\33\241\11\61\11\61\11\71f\22b\22S\42\213\354a$U\1\36\316\42\217F\60\266q\341\341\330"
-  "\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\36\317\36+F\220\35\312I"
-  "\301x \262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\36\320#\217F\60Fa\341Q\31"
-  "\301\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\36\321!\213F\220\255A"
-  "\365Psd\42\362 d\67B\23b\22b\22r\314$\304$\246D\26\331\0\36\322#\217F\60\256"
-  "\361\350Q\31\301\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\36\323\42\213"
-  "F\220\225IQy\250\71\62\21y\20\262\33\241\11\61\11\61\11\71f\22b\22S\42\213l\0\36\324"
-  "#\217F\60\66j\331Q\31\301\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216"
-  "\0\36\325\42\213F\220\35R\271A\311\71\62\21y\20\262\33\241\11\61\11\61\11\71f\22b\22S\42"
-  "\213l\0\36\326%\217F\60\256\221\300\230\321Q\31\301\273\203\241\261\221A\21ISZnK%$'"
-  "\6e\306\206\16\306\216\0\36\327#kF\220\25\12\241\220y\230\71\62\21y\20\262\33\241\11\61\11\61"
-  "\11\71f\22b\22S\42\213l\0\36\330$\317F.\266Q\31\301\273\203\241\261\221A\21ISZn"
-  "K%$'\6e\306\206\16\306\356A\207\227\1\36\331!\213F\216\245\71\62\21y\20\262\33\241\11\61"
-  "\11\61\11\71f\22b\22S\42\213\354a$U\1\36\332.\222FpFy\0y\210x$G\63\7"
-  "#\313FB\6EB$+FededededeF\205$\207\6\305\326\35L\336\1\36\333"
-  "#\15F\320\255Q\365\200D\42'\22B#c\42c\22\21r\42r\42b\62b\62SB#cV"
-  "\0\36\334.\222Fp\256y\10y\20y\24G\63\7#\313FB\6EB$+Fedede"
-  "dedeF\205$\207\6\305\326\35L\336\1\36\335$\15F\320\35aYy@\42\221\23\11\241\221"
-  "\61\221\61\211\10\71\21\71\21\61\31\61\231)\241\221\61+\0\36\336.\222Fp\66z\10y\0y\24"
-  "G\63\7#\313FB\6EB$+FededededeF\205$\207\6\305\326\35L\336"
-  "\1\36\337%-F\320\35\332Y\321x@\42\221\23\11\241\221\61\221\61\211\10\71\21\71\21\61\31\61\231"
-  ")\241\221\61+\0\36\340,rFp.[\11z\360\243\231\203\221e#!\203\42!\222\25\243\62\262"
-  "\62\262\62\262\62\262\62\243B\222C\203b\353\16&\357\0\36\341&\15F\320\35\21\261\263\30y\60\42"
-  "\221\23\11\241\221\61\221\61\211\10\71\21\71\21\61\31\61\231)\241\221\61+\0\36\342.\222Fn\246\243"
-  "\231\203\221e#!\203\42!\222\25\243\62\262\62\262\62\262\62\262\62\243B\222C\203b\353\16&\357Q"
-  "\314\3\314\3L\2\36\343#\15F\316\35\42\221\23\11\241\221\61\221\61\211\10\71\21\71\21\61\31\61\231"
-  ")\241\221\61{\70Yu\0\36\344\24\214J\16\6A\376\37\226M\34\314\34\304\3\211\252\2\36\345\24"
-  "\12F\216\5\61\376\231\204\320\304DI\205\270\240\42\0\36\346\25\214J\20\246Y\311\311\60A\376\37\226"
-  "M\34\314\34\204\0\36\347\25*F\220\235\311A\61q\61\376\231\204\320\304DI\205\0\36\350,\220J"
-  "P\66\351iyPA\21B\21B\231A\231A\21\302\12A!A!A!A!A!A!A\241"
-  "\261\251\203\271\203\60\0\36\351#\15F\320\255Q\365Pb\22d\22d\22d\42c\42c\22\21b#"
-  "b\62bBB+\252*d\0\36\352-\220JP&qy\0yPA\21B\21B\231A\231A\21"
-  "\302\12A!A!A!A!A!A!A\241\261\251\203\271\203\60\0\36\353$\15F\320\35aY"
-  "y(\61\11\62\11\62\11\62\221\61\221\61\211\10\261\21\61\31\61!\241\25U\25\62\0\36\354-\220J"
-  "P\246y\0\351\351PA\21B\21B\231A\231A\21\302\12A!A!A!A!A!A!A"
-  "\241\261\251\203\271\203\60\0\36\355%-F\320\235\341YIy(\61\11\62\11\62\11\62\221\61\221\61\211"
-  "\10\261\21\61\31\61!\241\25U\25\62\0\36\356,pJP\36\12\311\220y@%\204\42\204\62\203\62"
-  "\203\42\204\25\202B\202B\202B\202B\202B\202B\202BcS\7s\7a\0\36\357&\15F\320\35"
-  "\21\261\263\30y\30\61\11\62\11\62\11\62\221\61\221\61\211\10\261\21\61\31\61!\241\25U\25\62\0\36"
-  "\360+\220JN\6A\21B\21B\231A\231A\21\302\12A!A!A!A!A!A!A\241"
-  "\261\251\203\271\203x`q\225\0\36\361#\15F\316\5\61\11\62\11\62\11\62\221\61\221\61\211\10\261\21"
-  "\61\31\61!\241\25U\25\362P\262\352\0\36\362\36\216B\320-i\351x\250I\211\271\21\71\231)\251"
-  "\231\61\31\271\11\311\322Ya}\6\36\363%\253\302m\235IQy\0\71\11\61\11)\31!\31E\62"
-  "R\42R\22b\22rt\223\222\221\202c\204r\0\36\364\36\216B\316\205I\211\271\21\71\231)\251\231"
-  "\61\31\271\11\311\322Ya}\17+\254\14\0\36\365$+\302m\5\71\11\61\11)\31!\31E\62R"
-  "\42R\22b\22rt\223\222\221\22C\23#$\63r\0\36\366\36\216B\320-j\331\331\260I\211\271"
-  "\21\71\231)\251\231\61\31\271\11\311\322Ya}\6\36\367&\313\302m\245QI\301x\10\71\11\61\11"
-  ")\31!\31E\62R\42R\22b\22rt\223\222\221\202c\204r\0\36\370\36nB\320\245;\11z"
-  "\220I\211\271\21\71\231)\251\231\61\31\271\11\311\322Ya}\6\36\371&\253\302m\35\231\240#\21q"
-  "\71\11\61\11)\31!\31E\62R\42R\22b\22rt\223\222\221\202c\204r\0\0";
+// Generated by tools/fontmaker.py from -FreeType-Arial-Medium-R-Normal--22-160-100-100-P-108-ISO10646-1: 245 of 1186 glyphs
+const uint8_t myfont[6524] PROGMEM = 
+  "\365\0\4\3\5\5\5\6\6\26\26\366\373\20\373\20\373\2\264\5\302\13\220 \6\0@\320\4!\11\2J\320"
+  "\204\17\206\10\42\14\306D\365\4\21\236H\204D\0#$\14B\220%\31)\31)\31\251\240\220\203\7\63"
+  "\252d\244\202\242\204b\16\36\214\310H\5E\11E\311\10\1$&jF\217\255\60\233\211\10\65!4!4A#"
+  "Q\23avd\21S!4!4!%!\22\23\64v\221A\0%/1\306o\26\62!\21\251 \31!5\252dT\311\210\310\211($\221"
+  "\217\231\24\261\213\21\21\223\11\12\13J%\224*JDH\214*P\4\0&$\15F\320%B\211\61\231)!)\319"
+  "\211\271B\272\211\61\31\21\11)\11U$b#S$+Fl\4'\10\302D\225\204\203\2(\26\245\306\355\244\30"
+  "\21\31\21\31Md4\222\321HF(H(\0)\30\246\306\355\214(\251(\251(!UQBj\204\264\21\22\12\222\21"
+  "\2*\16\307\304\24\235\260\230\223\241\31\11\11\0+\16K\305\221\255\320\254\16\36D\205f\5,"
+  "\12\242\310\316\4\212\10\11\0-\10F\304\362\204\203\2.\7BH\320\4\2/\22\6B\320$EQA\212\202"
+  "\24E\5)\12R\4\60\24\12F\220\35\252\23!\21)2\376\231\204\220\310\32\23\0\61\17\6J\220\255"
+  " \231\211\203\210\31!\375\7\62\24\12F\220\235\232\203\20\241\62\62A\2719e{wp`3\33\12F\220"
+  "\35\242\203\20!\11\251A9\271)\302IAA\262*\211\221\31\23\0\64\33\13B\220=I\30192\11\61\11"
+  ")\21!\31!\31E\42\7\17\342$5\1\65\32\12F\220\225\203\220\203\10AM\242\16\42h\312\4\25\222"
+  "UI\214\314\230\0\66\32\12F\220\235\242\23\241\11)B\25%$\23Sd\234IHI\214\14\225\0\67\24\12"
+  "F\220\205\7\206r\12\345\344\346\4\345\4\265\23\24\38\34\12F\220\35\252\23!\21)\11)\11!\221"
+  "E53\22b\234UI\214\314\230\09\32\12F\220\35\242\203\20!\11\61\236I\314\214\34\4\211\10\222"
+  "\25\211\254\251\1:\10\202I\320\4s\2;\13\342\311\316\4s\212\10\11\0<\17KE\221M9\242\42*\272"
+  "\311J\226\3=\13\313\304\222\205\17\342\321\34\20>\20KE\221\5I\312J\206SEDe\203\0\77\30\12"
+  "F\220\25\233\221\211)2\211\60A9\271\261u\202\362\320\202B\0@\77\264\306\315\276\203P\232"
+  ":\311)a\31)1\21\241\203\30\11\31\241\31\211\230\241\65bB3bA$bB$bB$b2\22\62B#2\42\26E2$d\342"
+  "2\302C\203s\7\305e\0A#\17B\320\265\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31\301"
+  "\21I\11\321\1B\42\14J\320\205\203\240\203\21\61\219\119\119\11\251\221\3\231\203\219\11\271"
+  "\356$\16F\16d\0C\34\16F\20\246\263\3\241\251\21\301\11\311Za\215\207%%\4G\304f\16\306n\0"
+  "D\36\15J\20\206\3\241\203\31\261\21\271\11A\11\301J\36\26J\10J\210\215\34\314\34\10\1E\26"
+  "\14J\320\205\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0F\21\13J\260\205\17&uy r \42\251"
+  "/\1G!\17F0\256\263\203\241\261\221A\21Q\11aie\7b\7\243\22\242\22\223\42s3\7d7\0H\15\14J\20"
+  "\6A~x\360!\77\24I\10\2J\320\204\37\20J\16\10Fp5\375gD\214\16&,\0K#\14J\320\5\271\262\11\251"
+  "\21\241\31\231!\221)\211\261+\12\251\221!\241\31)\31\61\21\261\11\271B\1L\14\12J\220\5A\375"
+  "\77<80M,\17JP\206I\313\273\203\270\203\60\11\12)\11\12\251\20\12!\21\22\31\21\22\231\30\22"
+  "54\22\62\64\22A4DDCDR\2N\35\14J\20\6\301\272:\263+\12)\22!\222\31\32\31\42\21\242\11*\11"
+  "2w\205\2O\35\17F0\246\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0P\27\14J\320"
+  "\205\3\231\3\129\11\271Bve\23\7#W\242z\12Q\35/\306/\246\273\3\251\61\31I\21\311Z\276\225"
+  "\220\234\220\22\221\221\242:\30\273\230\26R%\15J\20\206\203\231\3\22\271\11A\11A\11A\11\271"
+  "\211\3\222\3!)!\251\31\261\21\271\11A\11\301J\1S\35\15F\320\235\253\3\31\261\219\219\21\331"
+  "\322C\333\331\312\272\119\221\203\251\33\0T\15\14F\260\205\17\246D\365\377\12\0U\20\14J\20"
+  "\6A\376\37\226M\34\314\34\204\0V!\16B\320\205I\11I\11I\2119\319\31\261!)\35\311\311\310\311"
+  "\10\206HJHJ\304\256\2W;\25B\220\206\2619\11\261\61\21\261\210\60\21)\11)\21)\11)\31!\11!"
+  "5\32\311h$\243&L$*DLBJBLBJB.BJ\42\60\42npnpN\12\0X!\16B\320\215A\219!)\251\231\61\31A\11"
+  "I\332\245\22\202\23c3bRBb#s\226\2Y\31\16B\320\205I\211\271\219\231)\251\231\61\31\271\11"
+  "\311\322Ya}\6Z\25\15B\260\215\203\212\203R\321\311M\225N.Uz\360\240\0[\14\204J\316\204\3"
+  "\231\374\377\15\1\134\24\6B\320\4!\251(!\251TBRQBR\251\204\4]\14\205B\316\204\203\31\375"
+  "\377\315\1^\24)\305S\35\271)*\11\31\21\31\25B\22B\22R\2_\10-@\216\205\3\3`\11d\304\366\204"
+  "\21\31\1a\26\212E\220\235\232\203\20\241\62A\231\13\213*2*\33\12\13\1b\26\12F\220\5A\235"
+  "\314HX\320X\221qVUe2!Q\2c\22\212Ep\35\252\23!\11\61B\235\25\211\254\61\1d\26\12F\220E\335"
+  "\214H\34H\10U\225\361\254hb\204\244B\0e\25\212E\220\35\252\23\241\62\262\203\7\203bU\22#"
+  "3&\0f\20\7B\320\34\222\22)\31\13\33)\375\33\0g\32*\306\215\235\21\211\3\11\241\62>\223\20"
+  "\2328\20\251\20$+\22\271\32\2h\22\12F\220\5A\235\220HX\320XU\221\361\63\1i\12\2F\220\4\242"
+  "\203\7\3j\15\244\276\215\24\245\42\372\177r \1k\33\12Fp\5A]\25M\310(\21\222\220\62\232\20"
+  "\222Q3\42$\42%!5l\10\2F\220\204\37\20m \220EP\6\221\241\21\11\213\12\232\241\242\241\42)"
+  "*)*)*)*)*)*)*\5n\20\212E\220\5\21\22\11\13\32\253*2~&o\30\213E\220\35\262\33\241\11\61\11"
+  "1\119f\22b\22S\42\213l\0p\27\12F\216\5\221\31\11\13\32+2\316\252\252L&$J\4\65\4q\26\12F\216"
+  "\235\21\211\3\11\241\252\62\236\25M\214\220T\10\352\0r\16\206E\360\4\21\212\223\231\31!}"
+  "\4s\24\211Ep\25\242\13\241\252\210\271\262\272*\252\232\211\13\0t\17\346\301\320\24!%\7%"
+  "B\372\21\11\1u\20\212E\220\5\61\376\231\204\320\304DI\205\0v\32\213Ap\59\11)\21)\21)\31E"
+  "2R1R\22b\22r\203\213\0w)\220A\20\6))*\25\62\64\42\62\64\42\62\64\62IB\204$D$\204$D$\244\42"
+  "D$\302\206\306\206\306\206\204\0x\31\213Ap\205\251\211!\31U\22bu\203se\22R22C\42R\3y +\302"
+  "m\59\11\61\11)\31!\31E2R\42R\22b\22rt\223\222\221\202c\204r\0z\22\213Ap\215\3\221\3\301\271"
+  "A\35\316\315\35<\10{\24\246\306\355\234\21\22!\275\221\231\221\222\212\22\322#\42\1|\7\242"
+  "\312\255\204\177}\26\246\306\355\204\231\251(!\275\232\31\231\21\322Q\220\314\214\20\0~\15"
+  "\213D\223\25\271\233\211\203\60\12\0\240\6\0@\320\4\260\15\306D\25\15\222\230\65\21J&\0\267"
+  "\7B\310\323\4\2\300&\217B\320\255iqy\340\265\264\22\222\42\222\42\203\62rBrRR\7S\7Dr2\202"
+  "2\202#\222\22\242\3\301&\217B\320\275a\365\320\303\263\264\22\222\42\222\42\203\62rBrRR\7"
+  "S\7Dr2\202\62\202#\222\22\242\3\302(\217B\320\65aR\21y\330\341YZ\11I\21I\221A\319!9)\251"
+  "\203\251\3\429\31A\31\301\21I\11\321\1\303(oB\320%\12\301\220y\330\341YZ\11I\21I\221A\31"
+  "9!9)\251\203\251\3\429\31A\31\301\21I\11\321\1\310\32\214J\320\235QYy\220\3\212\3\12Q\235"
+  "\36P\34P\210\352\364\340\301\0\311\31\214J\320\255I\365\60\7\24\7\24\242:=\2408\240\20\325"
+  "\351\301\203\1\312\32\214J\320\245\301:\211\371\3\212\3\12Q\235\36P\34P\210\352\364\340\301"
+  "\0\314\15\203F\320\4\21\221 \11\375\377\0\315\15\203J\320\14\12!\11\375\377\2\0\322!\217"
+  "F0\256iqy\320\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\323!\217F0Fa\351x\330"
+  "\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\324\42\217F0\266\331R\211y\300\273"
+  "\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\325!oF0.C\11z\300\273\203\241\261\221"
+  "A\21ISZnK%$'\6e\306\206\16\306\216\0\331\24\214J\20&QYy\20A\376\37\226M\34\314\34\204\0\332"
+  "\24\214J\20\66\311Iy\20A\376\37\226M\34\314\34\204\0\335\35\216B\320\275Y\365P\223\22s#r"
+  "2SR3c2r\23\222\245\263\302\372\14\0\340\32\12F\220\235AIy\210\232\203\20\241\62A\231\13\213"
+  "*2*\33\12\13\1\341\31\12F\220\2559\365 5\7!Be\202\62\27\26UdT6\24\26\2\342\32\12F\220%9*"
+  "\21\371\232\203\20\241\62A\231\13\213*2*\33\12\13\1\343\33\12F\220\35\21\231\23\31\371\232"
+  "\203\20\241\62A\231\13\213*2*\33\12\13\1\350\31\12F\220\35IAy\20\252\23\241\62\262\203\7"
+  "\203bU\22#3&\0\351\30\12F\220\2559\365 T'Bed\7\17\6\305\252$FfL\0\352\31\12F\220\245\61*"
+  "\21y\252\23\241\62\262\203\7\203bU\22#3&\0\354\14\3F\320\4\21\11!\11\375\17\355\14\4J\320"
+  "\214\11e\42\372\237\0\362\34\13F\220\35QIy \262\33\241\11\61\11\61\119f\22b\22S\42\213l\0"
+  "\363\33\13F\220\255A\365@d7B\23b\22b\22r\314$\304$\246D\26\331\0\364\35\13F\220\24592\21"
+  "y\20\262\33\241\11\61\11\61\119f\22b\22S\42\213l\0\365\36\13F\220\35\21\241\243\30y\20\262"
+  "\33\241\11\61\11\61\119f\22b\22S\42\213l\0\371\23\12F\220\235AIi1\376\231\204\320\304DI\205"
+  "\0\372\22\12F\220\2559\345b\374\63\11\241\211\211\222\12\1\375#\253\302m5AIy9\11\61\11)\31"
+  "!\31E2R\42R\22b\22rt\223\222\221\202c\204r\0\0\0\0 \36\241\1\342\36\257\1\367\36\276\1\344"
+  "\36\321\2\0\36\336\1\346\36\354\1\342 \31\1\371\377\377\1\2)\217B\320%\31A\231Pz\340\265"
+  "\264\22\222\42\222\42\203\62rBrRR\7S\7Dr2\202\62\202#\222\22\242\3\1\3\35\12F\220\25\31!"
+  "\11\261y\210\232\203\20\241\62A\231\13\213*2*\33\12\13\1\1\20(\17B\20\226\3\261\203)\261"
+  "!\271\31A\31\301\21\311\203\251\203)\21I\21\301\21A\31A\31\261\241\203\251\3!\0\1\21$\13"
+  "F\220E\251\243C\241\21\221\3\21\241\11\251\11\61\11\61\11\61\11\61\11\61\211\241\221\21\232"
+  "\12\11\0\1(\21\210>\320\224\30\11\13\221a1\375\377\6\0\1)\17\7B\320\14\221\203\31Q)\375o"
+  "\0\1h\26\214J\20\246\30\251\253\220yA\376\37\226M\34\314\34\204\0\1i\26\12F\220\35\21\231"
+  "\233\30a1\376\231\204\320\304DI\205\0\1\240(\22Fp\246\243\231\203\221e#!\203\42!\222\25\243"
+  "2\262\62\262\62\262\62\262\62\243B\222C\203b\353\16&\357\0\1\241 \215E\320\35\42\221\23\11"
+  "\241\221\61\221\61\211\109\219\21\61\31\61\231)\241\221\61+\0\1\257(\20JP\6A\21B\21B\231"
+  "A\231A\21\302\12A!A!A!A!A!A!A\241\261\251\203\271\203\60\0\1\260 \215E\320\5\61\11\62\11"
+  "2\11\62\221\61\221\61\211\10\261\21\61\31\61!\241\25U\25\62\0\3\0\12d\250\30\204\21\31\1"
+  "\3\1\12d\260\30\214\11%\0\3\3\12G\230\30\14\212\11\2\3\11\14\205,\30\4\42\211\21\21\0\3#"
+  "\10b \16\4\3\36\240(\217B\316\265\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31\301"
+  "\21I\11\321y0iu\0\36\241\32\12F\216\235\232\203\20\241\62A\231\13\213*2*\33\12\13qAE\0\36"
+  "\242(\217B\320-ra\351\350\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31\301\21I\11\321"
+  "\1\36\243\34*F\220\35JA\271x\220\232\203\20\241\62A\231\13\213*2*\33\12\13\1\36\244)\217"
+  "B\320=a\351Q\21\331\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31\301\21I\11\321\1\36"
+  "\245\36\212F\220\2559\365\60rT\42\362\65\7!Be\202\62\27\26UdT6\24\26\2\36\246)\217B\320-"
+  "q\351Q\21\331\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31\301\21I\11\321\1\36\247"
+  "\37\212F\220\225AIy\309*\21\371\232\203\20\241\62A\231\13\213*2*\33\12\13\1\36\250)\217B"
+  "\320-j\341Q\21\331\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31\301\21I\11\321\1\36"
+  "\251\37\212F\220\35J\2619A9*\21\371\232\203\20\241\62A\231\13\213*2*\33\12\13\1\36\252+\217"
+  "B\320\245\231\300\220\331Q\21\331\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31\301"
+  "\21I\11\321\1\36\253 jF\220\25\12\231\220y\109*\21\371\232\203\20\241\62A\231\13\213*2*\33"
+  "\12\13\1\36\254+\317B\316\265Q\21\331\341YZ\11I\21I\221A\319!9)\251\203\251\3\429\31A\31"
+  "\301\21I\11\321y0iu\0\36\255\36\212F\216%9*\21\371\232\203\20\241\62A\231\13\213*2*\33\12"
+  "\13qAE\0\36\256(\217B\320=a\331\240P\342\265\264\22\222\42\222\42\203\62rBrRR\7S\7Dr2\202"
+  "2\202#\222\22\242\3\36\257 \212F\220\2559\365\20\62B\22b\363\20\65\7!Be\202\62\27\26UdT6"
+  "\24\26\2\36\260(\217B\320-q\331\240P\342\265\264\22\222\42\222\42\203\62rBrRR\7S\7Dr2\202"
+  "2\202#\222\22\242\3\36\261!\212F\220\35IAy\10\31!\11\261y\210\232\203\20\241\62A\231\13\213"
+  "*2*\33\12\13\1\36\262(\217B\320-j\321\240P\342\265\264\22\222\42\222\42\203\62rBrRR\7S\7"
+  "Dr2\202\62\202#\222\22\242\3\36\263!\212F\220\35J\271\271\60\31!\11\261y\210\232\203\20\241"
+  "2A\231\13\213*2*\33\12\13\1\36\264*\217B\320\255\221\300\20\302\240P\342\265\264\22\222\42"
+  "\222\42\203\62rBrRR\7S\7Dr2\202\62\202#\222\22\242\3\36\265!jF\220\25\12\31\11j\31!\11\261"
+  "y\210\232\203\20\241\62A\231\13\213*2*\33\12\13\1\36\266)\317B\316\245\244\304ki%$E$E\6e"
+  "\344\204\344\244\244\16\246\16\210\344d\4e\4G$%D\347\301\244\325\1\36\267 \212F\216\25\31"
+  "!\11\261y\210\232\203\20\241\62A\231\13\213*2*\33\12\13qAE\0\36\270\33\214J\316\205\3\212"
+  "\3\12Q\235\36P\34P\210\352\364\340\301<\210\250*\0\36\271\31\12F\216\35\252\23\241\62\262"
+  "\203\7\203bU\22#3\366\20\202\212\0\36\272\33\214J\320\245Y\311\311\260\3\212\3\12Q\235\36"
+  "P\34P\210\352\364\340\301\0\36\273\33*F\220\35\302A\271x\20\252\23\241\62\262\203\7\203b"
+  "U\22#3&\0\36\274\35\214J\320\245\230\250+\21y\210\3\212\3\12Q\235\36P\34P\210\352\364\340"
+  "\301\0\36\275\33\12F\220\35\21\231\233\30y\252\23\241\62\262\203\7\203bU\22#3&\0\36\276\34"
+  "\214J\320\65\311\3209\31\231\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\36\277\35\212"
+  "F\220\2559\365\60cT\42\362T'Bed\7\17\6\305\252$FfL\0\36\300\34\214J\320\35\341\3209\31\231"
+  "\3\212\3\12Q\235\36P\34P\210\352\364\340\301\0\36\301\36\212F\220\225AIy\230\61*\21y\252"
+  "\23\241\62\262\203\7\203bU\22#3&\0\36\302\34\214J\320\35\322\3019\31\231\3\212\3\12Q\235"
+  "\36P\34P\210\352\364\340\301\0\36\303\36\212F\220\35J\2619\301\61*\21y\252\23\241\62\262"
+  "\203\7\203bU\22#3&\0\36\304\36\214J\320\235\221\250\20\2729\31\231\3\212\3\12Q\235\36P\34"
+  "P\210\352\364\340\301\0\36\305\37jF\220\25\12\231\220y\210\61*\21y\252\23\241\62\262\203"
+  "\7\203bU\22#3&\0\36\306\36\314J\316\2459\31\231\3\212\3\12Q\235\36P\34P\210\352\364\340\301"
+  "<\210\250*\0\36\307\35\212F\216\245\61*\21y\252\23\241\62\262\203\7\203bU\22#3\366\20\202"
+  "\212\0\36\310\17\205F\320\4\42\21\231\30\375\377\11\0\36\311\17%B\220\4\42\31\221@\31\375"
+  "O\0\36\312\12\202J\316\204\37\220\30\36\313\16\203F\216\4\119\11\375\217\16\4\36\314!\217"
+  "F.\246\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\356A\207\227\1\36\315\34\13F\216"
+  "\35\262\33\241\11\61\11\61\119f\22b\22S\42\213\354a$U\1\36\316\42\217F0\266q\341\341\330"
+  "\273\203\241\261\221A\21ISZnK%$'\6e\306\206\16\306\216\0\36\317\36+F\220\35\312I\301x \262"
+  "\33\241\11\61\11\61\119f\22b\22S\42\213l\0\36\320#\217F0Fa\341Q\31\301\273\203\241\261\221"
+  "A\21ISZnK%$'\6e\306\206\16\306\216\0\36\321!\213F\220\255A\365Psd\42\362 d7B\23b\22b\22r"
+  "\314$\304$\246D\26\331\0\36\322#\217F0\256\361\350Q\31\301\273\203\241\261\221A\21ISZnK%"
+  "$'\6e\306\206\16\306\216\0\36\323\42\213F\220\225IQy\25092\21y\20\262\33\241\11\61\11\61"
+  "\119f\22b\22S\42\213l\0\36\324#\217F06j\331Q\31\301\273\203\241\261\221A\21ISZnK%$'\6e\306"
+  "\206\16\306\216\0\36\325\42\213F\220\35R\271A\31192\21y\20\262\33\241\11\61\11\61\119f\22"
+  "b\22S\42\213l\0\36\326%\217F0\256\221\300\230\321Q\31\301\273\203\241\261\221A\21ISZnK%$"
+  "'\6e\306\206\16\306\216\0\36\327#kF\220\25\12\241\220y\23092\21y\20\262\33\241\11\61\11\61"
+  "\119f\22b\22S\42\213l\0\36\330$\317F.\266Q\31\301\273\203\241\261\221A\21ISZnK%$'\6e\306"
+  "\206\16\306\356A\207\227\1\36\331!\213F\216\24592\21y\20\262\33\241\11\61\11\61\119f\22b"
+  "\22S\42\213\354a$U\1\36\332-\222FpFyy\210x$G3\7#\313FB\6EB$+FededededeF\205$\207\6\305\326"
+  "\35L\336\1\36\333#\15F\320\255Q\365\200D\42'\22B#c\42c\22\21r\42r\42b2b2SB#cV\0\36\334.\222"
+  "Fp\256y\10y\20y\24G3\7#\313FB\6EB$+FededededeF\205$\207\6\305\326\35L\336\1\36\335$\15F\320"
+  "\35aYy@\42\221\23\11\241\221\61\221\61\211\109\219\21\61\31\61\231)\241\221\61+\0\36\336"
+  "-\222Fp6z\10yy\24G3\7#\313FB\6EB$+FededededeF\205$\207\6\305\326\35L\336\1\36\337%-F\320"
+  "\35\332Y\321x@\42\221\23\11\241\221\61\221\61\211\109\219\21\61\31\61\231)\241\221\61+\0"
+  "\36\340,rFp.[\11z\360\243\231\203\221e#!\203\42!\222\25\243\62\262\62\262\62\262\62\262\62"
+  "\243B\222C\203b\353\16&\357\0\36\341&\15F\320\35\21\261\263\30y0\42\221\23\11\241\221\61"
+  "\221\61\211\109\219\21\61\31\61\231)\241\221\61+\0\36\342+\222Fn\246\243\231\203\221e#!\203"
+  "\42!\222\25\243\62\262\62\262\62\262\62\262\62\243B\222C\203b\353\16&\357Q\314\257\4\36\343"
+  "#\15F\316\35\42\221\23\11\241\221\61\221\61\211\109\219\21\61\31\61\231)\241\221\61{8Yu\0"
+  "\36\344\24\214J\16\6A\376\37\226M\34\314\34\304\3\211\252\2\36\345\24\12F\216\5\61\376\231"
+  "\204\320\304DI\205\270\240\42\0\36\346\25\214J\20\246Y\311\311\60A\376\37\226M\34\314\34"
+  "\204\0\36\347\25*F\220\235\311A1q1\376\231\204\320\304DI\205\0\36\350,\220JP6\351iyPA\21"
+  "B\21B\231A\231A\21\302\12A!A!A!A!A!A!A\241\261\251\203\271\203\60\0\36\351#\15F\320\255Q"
+  "\365Pb\22d\22d\22d\42c\42c\22\21b#b2bBB+\252*d\0\36\352,\220JP&qyyPA\21B\21B\231A\231A\21"
+  "\302\12A!A!A!A!A!A!A\241\261\251\203\271\203\60\0\36\353$\15F\320\35aYy(1\11\62\11\62\11"
+  "2\221\61\221\61\211\10\261\21\61\31\61!\241\25U\25\62\0\36\354,\220JP\246y\351\351PA\21B"
+  "\21B\231A\231A\21\302\12A!A!A!A!A!A!A\241\261\251\203\271\203\60\0\36\355%-F\320\235\341"
+  "YIy(1\11\62\11\62\11\62\221\61\221\61\211\10\261\21\61\31\61!\241\25U\25\62\0\36\356,pJP"
+  "\36\12\311\220y@%\204\42\204\62\203\62\203\42\204\25\202B\202B\202B\202B\202B\202B\202Bc"
+  "S\7s\7a\0\36\357&\15F\320\35\21\261\263\30y\30\61\11\62\11\62\11\62\221\61\221\61\211\10"
+  "\261\21\61\31\61!\241\25U\25\62\0\36\360+\220JN\6A\21B\21B\231A\231A\21\302\12A!A!A!A!A!"
+  "A!A\241\261\251\203\271\203x`q\225\0\36\361#\15F\316\5\61\11\62\11\62\11\62\221\61\221\61"
+  "\211\10\261\21\61\31\61!\241\25U\25\362P\262\352\0\36\362\36\216B\320-i\351x\250I\211\271"
+  "\219\231)\251\231\61\31\271\11\311\322Ya}\6\36\363$\253\302m\235IQy9\11\61\11)\31!\31E2R"
+  "\42R\22b\22rt\223\222\221\202c\204r\0\36\364\36\216B\316\205I\211\271\219\231)\251\231\61"
+  "\31\271\11\311\322Ya}\17+\254\14\0\36\365$+\302m\59\11\61\11)\31!\31E2R\42R\22b\22rt\223"
+  "\222\221\22C\23#$3r\0\36\366\36\216B\320-j\331\331\260I\211\271\219\231)\251\231\61\31\271"
+  "\11\311\322Ya}\6\36\367&\313\302m\245QI\301x\109\11\61\11)\31!\31E2R\42R\22b\22rt\223\222"
+  "\221\202c\204r\0\36\370\36nB\320\245;\11z\220I\211\271\219\231)\251\231\61\31\271\11\311"
+  "\322Ya}\6\36\371&\253\302m\35\231\240#\21q9\11\61\11)\31!\31E2R\42R\22b\22rt\223\222\221"
+  "\202c\204r\0 \23\11L\300\222\205\17\6 \24\11V\300\322\206\177  \30\14\243\304\225\14\211"
+  "$\22\22\0 \31\12\242\304\225\4\212\210\1 \34\16\245\304\365\214\20\221\221\10\11\12\1 \35"
+  "\16\245\304\365\4\11\12\211\220\210\20\5 &\14QL\320\6)\251*\251\1\377\375\15\11Fp\205\203"
+  "9\375\277;\30\0";
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,109 @@
+#ifndef NAV_DECODER_H
+#define NAV_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+#include "nav_frame.h"
+#include "nav_protocol.h"
+#include "packbits.h"
+
+class IconCache;
+
+// Where NavDecoder puts frames. beginFrame() hands out the NavFrame to
+// decode into, already holding the current state: fields a frame leaves
+// out keep their value and deltas apply to its bitmap. endFrame() reports
+// whether it now holds the update. A frame that fails is left half-written,
+// so the NavFrame has to be scratch space such as a TripleBuffer back slot.
+// endFrame() also comes for frames rejected before beginFrame().
+class NavDecodeSink {
+public:
+  virtual ~NavDecodeSink() {}
+  virtual NavFrame& beginFrame() = 0;
+  // `missingIcon` is the uncached hash on NAV_ERR_ICON_MISS
+  virtual void endFrame(NavResult result, uint32_t missingIcon) = 0;
+};
+
+// Streaming decoder for legacy ">>>>>bitmap;title|eta|distance<<<<<" frames
+// and binary frames (nav_protocol.h). Fields are decoded as their bytes
+// arrive, whatever the write boundaries: bitmaps are copied, unpacked or
+// XORed straight into the sink's NavFrame and text lands in its strings,
+// so no frame is ever buffered. The CRC of a binary frame is summed on the
+// way and checked after its last byte, before the sink hears of it. Bitmaps
+// received as pixels are added to `icons`.
+class NavDecoder {
+public:
+  explicit NavDecoder(IconCache* icons = nullptr);
+
+  void push(const uint8_t* data, size_t length, NavDecodeSink& sink);
+  void reset();
+
+  bool receiving() const { return state_ != STATE_HUNT; }
+
+private:
+  enum State : uint8_t {
+    STATE_HUNT,          // between frames
+    STATE_HEADER,        // binary frame header
+    STATE_FIELD_HEADER,  // TLV type and length
+    STATE_FIELD,         // TLV value
+    STATE_SKIP,          // rest of a payload that is not decoded
+    STATE_CRC,
+    STATE_LEGACY
+  };
+
+  size_t hunt(const uint8_t* data, size_t length, NavDecodeSink& sink);
+  size_t header(const uint8_t* data, size_t length, NavDecodeSink& sink);
+  size_t fieldHeader(const uint8_t* data, size_t length);
+  size_t field(const uint8_t* data, size_t length);
+  size_t crc(const uint8_t* data, size_t length, NavDecodeSink& sink);
+  size_t legacy(const uint8_t* data, size_t length, NavDecodeSink& sink);
+
+  void beginField();
+  void endField();
+  void applyDelta(const uint8_t* data, size_t length);
+  void nextDeltaTile();
+  void legacyAppend(const uint8_t* data, size_t length);
+  void legacyNextField();
+  void fail(NavResult result);
+  void finish(NavResult result, NavDecodeSink& sink);
+
+  IconCache* icons_;
+  NavFrame* nav_;
+  State state_;
+  uint8_t startRun_;
+  uint8_t endRun_;
+  uint8_t partLen_;        // bytes gathered in part_
+  uint8_t part_[FRAME_BINARY_HEADER_LEN];
+  NavResult error_;        // first error in the payload
+  uint32_t crc_;
+  uint32_t value_;         // small little-endian field being gathered
+  uint32_t missingIcon_;
+  size_t payloadLeft_;
+  size_t frameLen_;        // legacy body bytes so far
+  uint8_t command_;
+  uint8_t version_;
+
+  // Field being decoded
+  uint8_t fieldType_;
+  size_t fieldLen_;
+  size_t fieldPos_;
+  char* text_;             // NavFrame string a text field goes to
+  size_t textCapacity_;
+
+  // Frame results, applied at the end
+  uint16_t baseId_;        // bitmap id deltas may apply to
+  uint16_t bitmapId_;
+  bool bitmapChanged_;
+  bool pixelsReceived_;
+  bool packBitsOk_;
+
+  // Delta field: tile mask, then the XOR data of the set tiles
+  uint8_t deltaMask_[NAV_DELTA_MASK_BYTES];
+  size_t deltaTile_;
+  size_t deltaTileLeft_;
+
+  uint8_t legacyField_;    // 0 bitmap, 1 title, 2 ETA, 3 distance
+  PackBitsDecoder packBits_;
+};
+
+#endif
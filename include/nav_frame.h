@@ -0,0 +1,45 @@
+#ifndef NAV_FRAME_H
+#define NAV_FRAME_H
+
+#include <stdint.h>
+#include "config.h"
+#include "fixed_string.h"
+
+#define NAV_TITLE_MAX    160
+#define NAV_FIELD_MAX    32
+
+// One complete navigation update, owned by a single TripleBuffer slot.
+struct NavFrame {
+  uint8_t bitmap[BITMAP_BYTES];
+  bool hasBitmap;
+  uint16_t bitmapId;  // sender's id for delta updates, 0 if unknown
+  FixedString<NAV_TITLE_MAX> title;
+  FixedString<NAV_FIELD_MAX> eta;
+  FixedString<NAV_FIELD_MAX> distance;
+#ifdef SKIP_UNCHANGED_FRAMES
+  uint32_t contentHash;   // of everything drawn, set when published; 0 if never
+#endif
+#ifdef ENABLE_PIPELINE_STATS
+  uint32_t firstWriteUs;  // stamps carried to the render loop
+  uint32_t parsedUs;
+#endif
+
+  NavFrame() { clear(); }
+
+  void clear() {
+    hasBitmap = false;
+    bitmapId = 0;
+    title = "N/A";
+    eta = "N/A";
+    distance = "N/A";
+#ifdef SKIP_UNCHANGED_FRAMES
+    contentHash = 0;
+#endif
+#ifdef ENABLE_PIPELINE_STATS
+    firstWriteUs = 0;
+    parsedUs = 0;
+#endif
+  }
+};
+
+#endif
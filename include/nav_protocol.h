@@ -0,0 +1,67 @@
+#ifndef NAV_PROTOCOL_H
+#define NAV_PROTOCOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Legacy frames: ">>>>>" packed bitmap ';' title '|' ETA '|' distance "<<<<<"
+#define FRAME_MARKER_LEN 5
+
+// Binary frame layout (all integers little endian):
+//   FRAME_HEADER | PROTOCOL_VERSION | command | payload length (u16)
+//   payload: TLV fields, each type (u8) | length (u16) | value
+//   CRC-32 (u32) over everything before it
+// Fields missing from a CMD_NAV_UPDATE keep their previous value.
+#define FRAME_BINARY_HEADER_LEN 5
+#define FRAME_BINARY_CRC_LEN 4
+#define NAV_TLV_HEADER_LEN  3
+
+#define NAV_TLV_BITMAP      0x01  // raw packed bitmap, BITMAP_BYTES long
+#define NAV_TLV_TITLE       0x02  // UTF-8, no terminator
+#define NAV_TLV_ETA         0x03
+#define NAV_TLV_DISTANCE    0x04
+#define NAV_TLV_BITMAP_DELTA 0x05 // base id (u16), tile mask, XOR data of set tiles
+#define NAV_TLV_BITMAP_ID   0x06  // u16 id of the bitmap this frame produces
+#define NAV_TLV_BITMAP_PACKBITS 0x07 // PackBits-compressed packed bitmap
+#define NAV_TLV_ICON_REF    0x08  // u32 IconCache::hash of a bitmap sent earlier
+
+// Delta bitmaps split the packed bitmap into fixed-size byte tiles. The mask
+// has one bit per tile (LSB first); each set tile is followed by its XOR
+// against the base bitmap. The last tile may be shorter than the others.
+#define NAV_DELTA_TILE_BYTES 16
+#define NAV_DELTA_TILES ((BITMAP_BYTES + NAV_DELTA_TILE_BYTES - 1) / NAV_DELTA_TILE_BYTES)
+#define NAV_DELTA_MASK_BYTES ((NAV_DELTA_TILES + 7) / 8)
+
+enum NavResult {
+  NAV_OK,
+  NAV_ERR_SEPARATOR,  // legacy frame without ';'
+  NAV_ERR_LENGTH,
+  NAV_ERR_VERSION,
+  NAV_ERR_CRC,
+  NAV_ERR_COMMAND,
+  NAV_ERR_FIELD,      // TLV overruns the payload
+  NAV_ERR_DELTA_BASE, // delta against a bitmap we do not have; wait for a keyframe
+  NAV_ERR_ICON_MISS   // icon reference not in the cache; app must resend pixels
+};
+
+// Builds a binary frame for the status characteristic.
+class NavFrameWriter {
+public:
+  NavFrameWriter(uint8_t* buffer, size_t capacity, uint8_t command);
+  void addField(uint8_t type, const void* value, size_t length);
+  void addU32(uint8_t type, uint32_t value);
+  // Appends the CRC and returns the frame length, or 0 if it did not fit.
+  size_t finish();
+
+private:
+  uint8_t* buffer_;
+  size_t capacity_;
+  size_t length_;
+  bool overflow_;
+};
+
+uint32_t navCrc32(uint32_t crc, const uint8_t* data, size_t length);
+const char* navResultString(NavResult result);
+
+#endif
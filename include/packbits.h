@@ -0,0 +1,38 @@
+#ifndef PACKBITS_H
+#define PACKBITS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Streaming PackBits decoder. Control byte n: 0..127 copies the next n + 1
+// bytes, -127..-1 repeats the next byte 1 - n times, -128 is a no-op.
+// Input can arrive in any number of pieces; output goes straight to `dst`.
+// With dst == nullptr it only counts the output.
+class PackBitsDecoder {
+public:
+  PackBitsDecoder(uint8_t* dst, size_t capacity) { reset(dst, capacity); }
+
+  void reset(uint8_t* dst, size_t capacity);
+  // Returns false once the output would overrun `capacity`.
+  bool feed(const uint8_t* src, size_t length);
+
+  size_t written() const { return written_; }
+  // True when the input ended on a run boundary.
+  bool idle() const { return mode_ == MODE_CONTROL; }
+
+private:
+  enum { MODE_CONTROL, MODE_LITERAL, MODE_REPEAT };
+
+  uint8_t* dst_;
+  size_t capacity_;
+  size_t written_;
+  uint8_t mode_;
+  uint8_t count_;
+  bool overrun_;
+};
+
+// Reference encoder for tools and host builds; returns the encoded size.
+// `dst` needs room for length + (length + 127) / 128 bytes.
+size_t packBitsEncode(const uint8_t* src, size_t length, uint8_t* dst);
+
+#endif
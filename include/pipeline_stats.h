@@ -0,0 +1,71 @@
+#ifndef PIPELINE_STATS_H
+#define PIPELINE_STATS_H
+
+#include "config.h"
+
+#ifdef ENABLE_PIPELINE_STATS
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// Pipeline stages, each timed in microseconds from the previous stamp
+enum PipelineStage : uint8_t {
+  STAGE_ASSEMBLE,  // first BLE write of a frame -> last byte decoded
+  STAGE_PARSE,     // last byte decoded -> frame published
+  STAGE_QUEUE,     // parse done -> render start
+  STAGE_RENDER,    // render start -> buffer flush done
+  STAGE_TOTAL,     // first BLE write -> buffer flush done
+  STAGE_COUNT
+};
+
+struct StageSummary {
+  uint32_t count;
+  uint32_t min;
+  uint32_t avg;
+  uint32_t max;
+  uint32_t p99;  // upper bound of the log2 bucket holding the 99th percentile
+};
+
+// Fixed-size latency histogram, one bucket per power of two. Lock-free for
+// a single writer; readers on other tasks see each counter atomically.
+class LatencyHistogram {
+public:
+  LatencyHistogram() { reset(); }
+  void record(uint32_t us);
+  StageSummary summary() const;
+  void reset();
+
+private:
+  static const uint8_t BUCKETS = 32;
+
+  std::atomic<uint32_t> buckets_[BUCKETS];
+  std::atomic<uint32_t> count_;
+  std::atomic<uint32_t> sum_;
+  std::atomic<uint32_t> min_;
+  std::atomic<uint32_t> max_;
+};
+
+class PipelineStats {
+public:
+  void record(PipelineStage stage, uint32_t startUs, uint32_t endUs) { stages_[stage].record(endUs - startUs); }
+  StageSummary summary(PipelineStage stage) const { return stages_[stage].summary(); }
+  void reset();
+
+  // CMD_PIPELINE_STATS frame for the status characteristic, one
+  // STATS_TLV_STAGE field per stage. Returns the length or 0.
+  size_t writeFrame(uint8_t* buffer, size_t capacity) const;
+
+  static const char* stageName(PipelineStage stage);
+
+private:
+  LatencyHistogram stages_[STAGE_COUNT];
+};
+
+// stage (u8) | count | min | avg | max | p99 (u32 each, microseconds)
+#define STATS_TLV_STAGE      0x01
+#define STATS_TLV_STAGE_LEN  21
+#define STATS_FRAME_MAX      (5 + STAGE_COUNT * (3 + STATS_TLV_STAGE_LEN) + 4)
+
+#endif
+#endif
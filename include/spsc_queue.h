@@ -0,0 +1,46 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Bounded lock-free FIFO for one producer and one consumer. Slots are
+// filled and drained in place, so a large T is never copied through the
+// queue. N must be a power of two; the indices run freely and wrap.
+template <typename T, uint32_t N>
+class SpscQueue {
+public:
+  static_assert(N && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+  SpscQueue() : head_(0), tail_(0) {}
+
+  // Producer side: the next free slot, or nullptr when full. Fill it, then
+  // push() it.
+  T* reserve() {
+    uint32_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == N) return nullptr;
+    return &slots_[tail & (N - 1)];
+  }
+  void push() { tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Consumer side: the oldest slot, or nullptr when empty. pop() hands it
+  // back once done with it.
+  T* front() {
+    uint32_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) return nullptr;
+    return &slots_[head & (N - 1)];
+  }
+  void pop() { head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Slots in use; exact on the producer side, a lower bound elsewhere
+  uint32_t size() const {
+    return tail_.load(std::memory_order_relaxed) - head_.load(std::memory_order_acquire);
+  }
+
+private:
+  T slots_[N];
+  std::atomic<uint32_t> head_;  // next slot to read, written by the consumer
+  std::atomic<uint32_t> tail_;  // next slot to fill, written by the producer
+};
+
+#endif
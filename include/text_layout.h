@@ -0,0 +1,56 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <stdint.h>
+#include <clib/u8g2.h>
+#include "fixed_string.h"
+#include "nav_frame.h"
+
+// Word wrapping for u8g2 text. Each code point is measured once, from
+// glyphCache; lines break at the last space that fits (mid-word only when a
+// word is wider than the line), and the result is a list of byte ranges
+// into the text.
+#define TEXT_LAYOUT_MAX_LINES     8
+#define TEXT_LAYOUT_CACHE_ENTRIES 6
+
+struct TextLine {
+  uint16_t start;   // byte offset into the text
+  uint16_t length;  // bytes, without the space it broke at
+};
+
+struct TextLayout {
+  uint8_t lineCount;
+  TextLine lines[TEXT_LAYOUT_MAX_LINES];
+};
+
+// Lays `text` out in the current font; the last line takes whatever does
+// not fit in TEXT_LAYOUT_MAX_LINES
+void layoutText(u8g2_t* u8g2, const char* text, int16_t maxWidth, TextLayout& layout);
+// Draws one line glyph by glyph, without copying it out of the text
+void drawTextLine(u8g2_t* u8g2, int16_t x, int16_t y, const char* text, const TextLine& line);
+
+// Layouts of the last few strings drawn, keyed by text, font and width, so
+// redrawing unchanged text skips the measuring.
+class TextLayoutCache {
+public:
+  TextLayoutCache() : clock_(0), misses_(0) {}
+
+  const TextLayout& get(u8g2_t* u8g2, const char* text, int16_t maxWidth);
+  uint32_t misses() const { return misses_; }
+
+private:
+  struct Entry {
+    const uint8_t* font = nullptr;
+    int16_t maxWidth = 0;
+    uint32_t lastUse = 0;
+    FixedString<NAV_TITLE_MAX> text;
+    TextLayout layout = {};
+  };
+
+  Entry entries_[TEXT_LAYOUT_CACHE_ENTRIES];
+  TextLayout scratch_;  // for text too long to cache
+  uint32_t clock_;
+  uint32_t misses_;
+};
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Compact binary trace of BLE traffic, recorded on the device and replayed
+// by the host build (src/native/main.cpp, `replay`).
+//
+//   header: "NVTR" | TRACE_VERSION
+//   record: varint(deltaUs << 2 | event), and for TRACE_WRITE
+//           varint(length) | bytes
+//
+// Varints are LEB128 (7 bits per byte, low bits first); deltaUs is the time
+// since the previous record.
+#define TRACE_VERSION     1
+#define TRACE_HEADER_LEN  5
+#define TRACE_VARINT_MAX  10
+
+enum TraceEvent : uint8_t {
+  TRACE_WRITE,       // one write to the data characteristic
+  TRACE_CONNECT,
+  TRACE_DISCONNECT
+};
+
+struct TraceRecord {
+  uint64_t deltaUs;
+  TraceEvent event;
+  const uint8_t* data;
+  size_t length;
+};
+
+// Receives each encoded record as a header and an optional payload
+typedef void (*TraceOutput)(const uint8_t* head, size_t headLength, const uint8_t* data, size_t length);
+
+class TraceWriter {
+public:
+  explicit TraceWriter(TraceOutput output) : output_(output), lastUs_(0), started_(false) {}
+
+  // Emits the file header; the first record is timed from here
+  void begin(uint32_t nowUs);
+  void record(uint32_t nowUs, TraceEvent event, const uint8_t* data = nullptr, size_t length = 0);
+  bool started() const { return started_; }
+
+private:
+  TraceOutput output_;
+  uint32_t lastUs_;
+  bool started_;
+};
+
+// Walks a trace held in memory; payloads point into it.
+class TraceReader {
+public:
+  TraceReader(const uint8_t* data, size_t length);
+
+  bool valid() const { return valid_; }
+  // False at the end or on a truncated record
+  bool next(TraceRecord& record);
+
+private:
+  bool readVarint(uint64_t& value);
+
+  const uint8_t* data_;
+  size_t length_;
+  size_t offset_;
+  bool valid_;
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef TRANSFER_RECEIVER_H
+#define TRANSFER_RECEIVER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "config.h"
+
+// Receiving end of the flow-controlled transfer characteristic. Each write
+// is one chunk: a 2-byte LE word holding a 15-bit sequence number (bit 15
+// asks for an ACK right away), then the payload. The sender may have the
+// TRANSFER_WINDOW chunks starting at the cumulative ACK in flight; chunks
+// that arrive past a gap are held until it fills, so only lost chunks are
+// sent again. Payloads come out in sequence order, each exactly once.
+//
+// ACK notifications (TRANSFER_ACK_LEN bytes): the next sequence number
+// expected (u16 LE), a selective ACK mask (u16 LE, bit i = next + 1 + i is
+// held) and the credit (u8): how many chunks from `next` on the sender may
+// have outstanding, which is the window less the chunks held past a gap.
+
+#define TRANSFER_HEADER_LEN    2
+#define TRANSFER_CHUNK_MAX     (INGEST_WRITE_MAX - TRANSFER_HEADER_LEN)
+#define TRANSFER_SEQ_MASK      0x7FFF
+#define TRANSFER_FLAG_ACK      0x8000
+#define TRANSFER_ACK_LEN       5
+
+static_assert(TRANSFER_WINDOW && (TRANSFER_WINDOW & (TRANSFER_WINDOW - 1)) == 0,
+              "TRANSFER_WINDOW must be a power of two");
+static_assert(TRANSFER_WINDOW <= 16, "the selective ACK mask covers 16 chunks");
+static_assert(TRANSFER_WINDOW <= INGEST_QUEUE_WRITES, "a full window must fit the ingest queue");
+
+class ChunkSink {
+public:
+  virtual ~ChunkSink() {}
+  virtual void onChunk(const uint8_t* data, size_t length) = 0;
+};
+
+struct TransferCounters {
+  uint32_t chunks;       // delivered in order
+  uint32_t held;         // arrived past a gap
+  uint32_t heldPeak;     // most chunks held at once
+  uint32_t duplicates;   // already delivered or held
+  uint32_t outOfWindow;  // past the credit the sender was given
+  uint32_t malformed;
+  uint32_t acks;
+};
+
+class TransferReceiver {
+public:
+  TransferReceiver() { reset(); }
+
+  // New connection: the sender starts again at sequence number 0
+  void reset();
+  void receive(const uint8_t* data, size_t length, ChunkSink& sink);
+
+  // An ACK is owed: the sender asked for one, a gap or duplicate showed up,
+  // or TRANSFER_ACK_EVERY chunks went by without one
+  bool ackDue() const { return ackDue_; }
+  size_t ackFrame(uint8_t* buffer);
+
+  uint16_t next() const { return next_; }
+  const TransferCounters& counters() const { return counters_; }
+  void resetCounters() { counters_ = TransferCounters{}; }
+
+private:
+  void advance();
+
+  uint8_t slots_[TRANSFER_WINDOW][TRANSFER_CHUNK_MAX];  // by sequence number modulo the window
+  uint16_t lengths_[TRANSFER_WINDOW];
+  uint32_t held_;       // bit i: next_ + i is in its slot
+  uint16_t next_;
+  uint8_t sinceAck_;
+  bool ackDue_;
+  TransferCounters counters_;
+};
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Lock-free "latest value" slot for one writer and one reader.
+// The writer fills back() and publishes it with a single atomic swap; the
+// reader picks up the newest published slot with update(). Neither side
+// ever waits, and the reader never sees a half-written value.
+template <typename T>
+class TripleBuffer {
+public:
+  TripleBuffer() : back_(0), middle_(1), front_(2), published_(1) {}
+
+  // Writer side. publish() returns true when the value it replaces was
+  // never picked up by the reader.
+  T& back() { return slots_[back_]; }
+  bool publish() {
+    published_ = back_;
+    uint8_t old = middle_.exchange(back_ | FRESH, std::memory_order_acq_rel);
+    back_ = old & INDEX;
+    return old & FRESH;
+  }
+  // The value published last. The reader may be looking at it too, but
+  // nobody writes it until a newer one is published.
+  const T& published() const { return slots_[published_]; }
+
+  // Reader side: returns true when a newer value became front().
+  bool update() {
+    if (!(middle_.load(std::memory_order_relaxed) & FRESH)) return false;
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+    return true;
+  }
+  const T& front() const { return slots_[front_]; }
+
+private:
+  static const uint8_t INDEX = 0x03;
+  static const uint8_t FRESH = 0x04;
+
+  T slots_[3];
+  uint8_t back_;
+  std::atomic<uint8_t> middle_;
+  uint8_t front_;
+  uint8_t published_;  // writer side
+};
+
+#endif
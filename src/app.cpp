@@ -0,0 +1,488 @@
+#include "app.h"
+
+#include <string.h>
+#include <atomic>
+#include "hal.h"
+#include "display.h"
+#include "glyph_cache.h"
+#include "icon_cache.h"
+#include "link_tuner.h"
+#include "nav_decoder.h"
+#include "nav_frame.h"
+#include "nav_protocol.h"
+#include "pipeline_stats.h"
+#include "spsc_queue.h"
+#include "transfer_receiver.h"
+#include "triple_buffer.h"
+
+// Set by appSetConnected() on the BLE side, read by the render task
+static std::atomic<bool> deviceConnected(false);
+static std::atomic<bool> displayNeedsUpdate(true);
+
+// Marquee frames sit on a fixed grid; a frame whose slot has passed is
+// dropped rather than drawn late, since the scroll offset follows the clock
+#define SCROLL_FRAME_MS (1000 / SCROLL_FPS)
+static bool scrollPaced = false;
+static uint32_t nextScrollFrame = 0;
+static uint32_t scrollFramesDrawn = 0;
+static uint32_t scrollFramesDropped = 0;
+
+// Navigation frames: the render loop draws the newest one published, so
+// a frame replaced before it got there is coalesced into the next
+static uint32_t navFramesDrawn = 0;
+static uint32_t navFramesCoalesced = 0;   // ingest side
+static uint32_t navFramesUnchanged = 0;  // same content as the screen, not drawn
+#ifdef SKIP_UNCHANGED_FRAMES
+static uint32_t shownHash = 0;  // contentHash of the frame on screen
+#endif
+
+// BLE writes waiting for the ingest task
+struct QueuedWrite {
+  uint32_t arrivalUs;
+  uint16_t length;
+  bool transfer;  // a chunk from the transfer characteristic
+  bool afterGap;  // data writes before it were dropped
+  uint8_t data[INGEST_WRITE_MAX];
+};
+static SpscQueue<QueuedWrite, INGEST_QUEUE_WRITES> writeQueue;
+static std::atomic<uint32_t> writesDropped(0);
+static std::atomic<bool> writeGap(false);  // BLE side: a data write was dropped since the last one queued
+static uint32_t writeQueuePeak = 0;  // most slots in use at once
+
+// Parsed Data: decoded by the ingest task straight into the back slot, read
+// by the render loop
+static TripleBuffer<NavFrame> navFrames;
+static IconCache iconCache;
+static NavDecoder decoder(&iconCache);
+
+// Flow-controlled transfer: chunks are put back in order by the ingest task
+static TransferReceiver transferReceiver;
+static uint32_t transferConnection = 0;  // connectionCount transferReceiver is set up for
+static std::atomic<bool> transferStatsReset(false);  // the ingest task owns the counters
+
+// Link tuning: the BLE callbacks only leave marks here, the render task
+// runs linkTuner and makes the requests
+static LinkTuner linkTuner;
+static std::atomic<uint32_t> connectionCount(0);  // bumped on every connect
+static std::atomic<uint32_t> lastWriteMs(0);
+static std::atomic<bool> linkChanged(false);
+static std::atomic<bool> linkRelaxed(false);  // the next write should wake the render task
+// How the last parameter / PHY procedure ended, until serviceLink() takes it
+enum LinkOutcome : uint8_t { LINK_OUTCOME_NONE, LINK_OUTCOME_OK, LINK_OUTCOME_FAILED };
+static std::atomic<uint8_t> paramsOutcome(LINK_OUTCOME_NONE);
+static std::atomic<uint8_t> phyOutcome(LINK_OUTCOME_NONE);
+static uint32_t tunedConnection = 0;          // connectionCount linkTuner is set up for
+static LinkState linkState = {};
+static LinkProfile reportedProfile = LINK_PROFILE_NONE;
+static bool linkReported = false;
+
+#ifdef ENABLE_PIPELINE_STATS
+static PipelineStats pipelineStats;
+static uint32_t chunkUs = 0;       // arrival of the write being pushed
+static uint32_t frameStartUs = 0;  // first write of the frame being assembled
+#endif
+
+// Tells the app which icon to send as pixels
+static void sendIconNack(uint32_t key) {
+  uint8_t buffer[FRAME_BINARY_HEADER_LEN + NAV_TLV_HEADER_LEN + 4 + FRAME_BINARY_CRC_LEN];
+  NavFrameWriter writer(buffer, sizeof(buffer), CMD_ICON_NACK);
+  writer.addU32(NAV_TLV_ICON_REF, key);
+  size_t length = writer.finish();
+  halNotifyStatus(buffer, length);
+}
+
+#ifdef SKIP_UNCHANGED_FRAMES
+// CRC over everything updateDisplay draws from a frame
+static uint32_t contentHash(const NavFrame& nav) {
+  uint32_t crc = navCrc32(0, (const uint8_t*)&nav.hasBitmap, 1);
+  if (nav.hasBitmap) crc = navCrc32(crc, nav.bitmap, BITMAP_BYTES);
+  // The terminators keep "ab" + "c" apart from "a" + "bc"
+  crc = navCrc32(crc, (const uint8_t*)nav.title.c_str(), nav.title.size() + 1);
+  crc = navCrc32(crc, (const uint8_t*)nav.eta.c_str(), nav.eta.size() + 1);
+  return navCrc32(crc, (const uint8_t*)nav.distance.c_str(), nav.distance.size() + 1);
+}
+#endif
+
+// Frame Sink: each frame is decoded into the back slot, starting from the
+// last one published, and published once it checks out
+class NavFrameSink : public NavDecodeSink {
+  NavFrame& beginFrame() override {
+    NavFrame& nav = navFrames.back();
+    nav = navFrames.published();
+    return nav;
+  }
+
+  void endFrame(NavResult result, uint32_t missingIcon) override {
+#ifdef ENABLE_PIPELINE_STATS
+    uint32_t completeUs = halMicros();
+    pipelineStats.record(STAGE_ASSEMBLE, frameStartUs, completeUs);
+#endif
+    if (result == NAV_OK) {
+#ifdef SKIP_UNCHANGED_FRAMES
+      navFrames.back().contentHash = contentHash(navFrames.back());
+#endif
+#ifdef ENABLE_PIPELINE_STATS
+      NavFrame& nav = navFrames.back();
+      nav.firstWriteUs = frameStartUs;
+      nav.parsedUs = halMicros();
+      pipelineStats.record(STAGE_PARSE, completeUs, nav.parsedUs);
+#endif
+      if (navFrames.publish()) navFramesCoalesced++;
+      halRenderWake();
+    } else {
+      if (result == NAV_ERR_ICON_MISS) sendIconNack(missingIcon);
+      halLog("Invalid data: %s\n", navResultString(result));
+    }
+#ifdef ENABLE_PIPELINE_STATS
+    // A frame that starts later in this write began with it
+    frameStartUs = chunkUs;
+#endif
+  }
+};
+
+static NavFrameSink frameSink;
+
+static void ingestWrite(const uint8_t* data, size_t length, uint32_t arrivalUs) {
+#ifdef ENABLE_PIPELINE_STATS
+  chunkUs = arrivalUs;
+  if (!decoder.receiving()) frameStartUs = chunkUs;
+#else
+  (void)arrivalUs;
+#endif
+  decoder.push(data, length, frameSink);
+}
+
+// Process Received Data
+void processReceivedData(const uint8_t* data, size_t length) {
+  ingestWrite(data, length, halMicros());
+}
+
+static void noteWrite() {
+  lastWriteMs.store(halMillis());
+  // Frames are about to stream over a link tuned for idling
+  if (linkRelaxed.load()) halRenderWake();
+}
+
+static bool queueSlot(const uint8_t* data, size_t length, bool transfer, uint32_t arrivalUs) {
+  QueuedWrite* slot = writeQueue.reserve();
+  if (!slot) {
+    halLog("Ingest queue full, write dropped\n");
+    writesDropped++;
+    // A lost transfer chunk is sent again; a lost data write leaves a hole
+    // in the stream that the next one must not be spliced across
+    if (!transfer) writeGap = true;
+    return false;
+  }
+  slot->arrivalUs = arrivalUs;
+  slot->length = length;
+  slot->transfer = transfer;
+  slot->afterGap = !transfer && writeGap.exchange(false);
+  memcpy(slot->data, data, length);
+  writeQueue.push();
+  uint32_t used = writeQueue.size();
+  if (used > writeQueuePeak) writeQueuePeak = used;
+  return true;
+}
+
+bool appQueueWrite(const uint8_t* data, size_t length) {
+  uint32_t arrivalUs = halMicros();
+  noteWrite();
+  bool queued = true;
+  // A write longer than a slot takes several
+  while (length > 0) {
+    size_t part = length < INGEST_WRITE_MAX ? length : INGEST_WRITE_MAX;
+    if (!queueSlot(data, part, false, arrivalUs)) {
+      queued = false;
+      break;
+    }
+    data += part;
+    length -= part;
+  }
+  halIngestWake();
+  return queued;
+}
+
+bool appQueueTransfer(const uint8_t* data, size_t length) {
+  uint32_t arrivalUs = halMicros();
+  noteWrite();
+  // A dropped chunk is missing from the next ACK and sent again
+  bool queued = length <= INGEST_WRITE_MAX && queueSlot(data, length, true, arrivalUs);
+  halIngestWake();
+  return queued;
+}
+
+// Hands the chunks transferReceiver releases to the assembler
+class TransferChunkSink : public ChunkSink {
+public:
+  uint32_t arrivalUs = 0;
+
+  void onChunk(const uint8_t* data, size_t length) override {
+    ingestWrite(data, length, arrivalUs);
+  }
+};
+
+static TransferChunkSink chunkSink;
+
+void appIngest() {
+  uint32_t connection = connectionCount.load();
+  if (connection != transferConnection) {
+    transferConnection = connection;
+    transferReceiver.reset();
+    // A frame cut off by a disconnect must not take the new link's bytes
+    decoder.reset();
+  }
+  if (transferStatsReset.exchange(false)) transferReceiver.resetCounters();
+  while (QueuedWrite* write = writeQueue.front()) {
+    if (write->transfer) {
+      chunkSink.arrivalUs = write->arrivalUs;
+      transferReceiver.receive(write->data, write->length, chunkSink);
+    } else {
+      // The frame being decoded lost bytes; hunt for the next one instead
+      if (write->afterGap) decoder.reset();
+      ingestWrite(write->data, write->length, write->arrivalUs);
+    }
+    writeQueue.pop();
+  }
+  // One ACK covers everything drained
+  if (transferReceiver.ackDue()) {
+    uint8_t ack[TRANSFER_ACK_LEN];
+    halNotifyTransfer(ack, transferReceiver.ackFrame(ack));
+  }
+}
+
+static void logLink() {
+  uint32_t intervalUs = linkState.interval * 1250u;
+  halLog("link: mtu %u, phy %u/%u, interval %u.%02u ms, latency %u, timeout %u ms, %s%s\n", (unsigned)linkState.mtu,
+         (unsigned)linkState.txPhy, (unsigned)linkState.rxPhy, (unsigned)(intervalUs / 1000),
+         (unsigned)(intervalUs % 1000 / 10), (unsigned)linkState.latency, (unsigned)linkState.timeout * 10,
+         linkProfileName(linkTuner.applied()), linkTuner.phyRefused() ? ", 2M PHY refused" : "");
+}
+
+#ifdef ENABLE_PIPELINE_STATS
+size_t appStatsFrame(uint8_t* buffer, size_t capacity) {
+  return pipelineStats.writeFrame(buffer, capacity);
+}
+#endif
+
+void appDumpStats() {
+  halLog("nav frames: %u drawn, %u coalesced, %u unchanged\n", (unsigned)navFramesDrawn,
+         (unsigned)navFramesCoalesced, (unsigned)navFramesUnchanged);
+  halLog("scroll frames: %u drawn, %u dropped\n", (unsigned)scrollFramesDrawn, (unsigned)scrollFramesDropped);
+  halLog("glyph cache: %u hits, %u misses\n", (unsigned)glyphCache.hits(), (unsigned)glyphCache.misses());
+  halLog("ingest queue: %u writes dropped\n", (unsigned)writesDropped.load());
+  // Decoder state is all ingest keeps between writes; the queue and the
+  // transfer window hold writes still on their way to it
+  halLog("ingest memory: decoder %u bytes, queue peak %u of %u writes (%u bytes)\n", (unsigned)sizeof(NavDecoder),
+         (unsigned)writeQueuePeak, (unsigned)INGEST_QUEUE_WRITES, (unsigned)(writeQueuePeak * sizeof(QueuedWrite)));
+  const TransferCounters& transfer = transferReceiver.counters();
+  halLog("transfer: %u chunks, %u held (peak %u of %u), %u duplicates, %u out of window, %u malformed, %u acks\n",
+         (unsigned)transfer.chunks, (unsigned)transfer.held, (unsigned)transfer.heldPeak, (unsigned)TRANSFER_WINDOW,
+         (unsigned)transfer.duplicates,
+         (unsigned)transfer.outOfWindow, (unsigned)transfer.malformed, (unsigned)transfer.acks);
+  if (deviceConnected) logLink();
+#ifdef ENABLE_PIPELINE_STATS
+  halLog("stage       count     min     avg     max     p99 (us)\n");
+  for (uint8_t i = 0; i < STAGE_COUNT; i++) {
+    StageSummary s = pipelineStats.summary((PipelineStage)i);
+    halLog("%-9s %7u %7u %7u %7u %7u\n", PipelineStats::stageName((PipelineStage)i),
+           (unsigned)s.count, (unsigned)s.min, (unsigned)s.avg, (unsigned)s.max, (unsigned)s.p99);
+  }
+#endif
+}
+
+void appResetStats() {
+#ifdef ENABLE_PIPELINE_STATS
+  pipelineStats.reset();
+#endif
+  scrollFramesDrawn = 0;
+  scrollFramesDropped = 0;
+  navFramesDrawn = 0;
+  navFramesCoalesced = 0;
+  navFramesUnchanged = 0;
+  glyphCache.resetCounters();
+  writesDropped = 0;
+  writeQueuePeak = 0;
+  transferStatsReset = true;
+}
+
+void appSetup() {
+  displayBegin();
+  iconCache.load();
+  updateDisplay(navFrames.front(), deviceConnected);
+  displayNeedsUpdate = false;
+}
+
+void appSetConnected(bool connected) {
+  if (connected) {
+    lastWriteMs.store(halMillis());
+    // Writes of the last connection may still be queued ahead of the
+    // first one of this connection
+    writeGap = true;
+    connectionCount++;
+  }
+  deviceConnected = connected;
+  displayNeedsUpdate = true;
+  halRenderWake();
+}
+
+void appLinkChanged() {
+  linkChanged = true;
+  halRenderWake();
+}
+
+void appLinkParamsUpdated(bool ok) {
+  paramsOutcome = ok ? LINK_OUTCOME_OK : LINK_OUTCOME_FAILED;
+  appLinkChanged();
+}
+
+void appLinkPhyUpdated(bool on2M) {
+  phyOutcome = on2M ? LINK_OUTCOME_OK : LINK_OUTCOME_FAILED;
+  appLinkChanged();
+}
+
+// Hands the procedure outcomes the BLE task left to linkTuner
+static void takeLinkOutcomes(uint32_t now) {
+  uint8_t outcome = paramsOutcome.exchange(LINK_OUTCOME_NONE);
+  if (outcome != LINK_OUTCOME_NONE) linkTuner.paramsUpdated(outcome == LINK_OUTCOME_OK, now);
+  outcome = phyOutcome.exchange(LINK_OUTCOME_NONE);
+  if (outcome != LINK_OUTCOME_NONE) linkTuner.phyUpdated(outcome == LINK_OUTCOME_OK, now);
+}
+
+// Makes the requests linkTuner asks for and reports the link whenever it
+// or the profile changed, or someone subscribed to the status
+static void serviceLink(uint32_t now) {
+  if (!deviceConnected) {
+    if (linkTuner.connected()) linkTuner.disconnect();
+    linkRelaxed = false;
+    return;
+  }
+  uint32_t connection = connectionCount.load();
+  if (connection != tunedConnection) {
+    tunedConnection = connection;
+    linkTuner.connect(now);
+    // Outcomes of the previous connection's procedures
+    paramsOutcome = LINK_OUTCOME_NONE;
+    phyOutcome = LINK_OUTCOME_NONE;
+    linkChanged = true;
+  }
+  linkTuner.write(lastWriteMs.load());
+  takeLinkOutcomes(now);
+
+  LinkRequest request;
+  while ((request = linkTuner.poll(now)) != LINK_REQUEST_NONE) {
+    bool sent = request == LINK_REQUEST_PHY_2M
+                    ? halLinkRequestPhy2M()
+                    : halLinkRequestParams(request == LINK_REQUEST_FAST ? linkFastParams : linkRelaxedParams);
+    if (!sent) halLog("link: %s request not sent\n", linkRequestName(request));
+    linkTuner.requested(request, sent, now);
+    // A peer that answers at once (the host build) has already reported
+    takeLinkOutcomes(now);
+  }
+  linkRelaxed = linkTuner.applied() == LINK_PROFILE_RELAXED;
+
+  if (linkChanged.exchange(false)) {
+    LinkState state;
+    halLinkRead(state);
+    if (state != linkState) {
+      linkState = state;
+      logLink();
+    }
+    linkReported = false;
+  }
+  if (linkTuner.applied() != reportedProfile) {
+    reportedProfile = linkTuner.applied();
+    linkReported = false;
+  }
+  if (!linkReported && halStatusSubscribed()) {
+    uint8_t buffer[LINK_FRAME_MAX];
+    size_t length = linkStatusFrame(linkState, reportedProfile, buffer, sizeof(buffer));
+    halNotifyStatus(buffer, length);
+    linkReported = true;
+  }
+}
+
+#ifdef ENABLE_PIPELINE_STATS
+static uint32_t lastStatsNotify = 0;
+#endif
+
+bool appLoop() {
+  uint32_t now = halMillis();
+  if (!displayScrolling()) {
+    scrollPaced = false;
+  } else if (!scrollPaced) {
+    scrollPaced = true;
+    nextScrollFrame = now + SCROLL_FRAME_MS;
+  } else if ((int32_t)(now - nextScrollFrame) >= 0) {
+    displayScrollTick();
+    displayNeedsUpdate = true;
+    scrollFramesDrawn++;
+    uint32_t missed = (now - nextScrollFrame) / SCROLL_FRAME_MS;
+    scrollFramesDropped += missed;
+    nextScrollFrame += (missed + 1) * SCROLL_FRAME_MS;
+  }
+  bool newFrame = navFrames.update();
+#ifdef SKIP_UNCHANGED_FRAMES
+  if (newFrame && !displayNeedsUpdate && navFrames.front().contentHash == shownHash) {
+    // Drawing it would not change a pixel
+    navFramesUnchanged++;
+    newFrame = false;
+  }
+#endif
+  if (newFrame) {
+    displayNeedsUpdate = true;
+    navFramesDrawn++;
+  }
+  // Cleared before drawing, so a request made meanwhile is not lost
+  if (displayNeedsUpdate.exchange(false)) {
+#ifdef ENABLE_PIPELINE_STATS
+    uint32_t renderUs = halMicros();
+#endif
+    updateDisplay(navFrames.front(), deviceConnected);
+#ifdef SKIP_UNCHANGED_FRAMES
+    shownHash = navFrames.front().contentHash;
+#endif
+#ifdef ENABLE_PIPELINE_STATS
+    if (newFrame && navFrames.front().firstWriteUs) {
+      const NavFrame& nav = navFrames.front();
+      uint32_t flushedUs = halMicros();
+      pipelineStats.record(STAGE_QUEUE, nav.parsedUs, renderUs);
+      pipelineStats.record(STAGE_RENDER, renderUs, flushedUs);
+      pipelineStats.record(STAGE_TOTAL, nav.firstWriteUs, flushedUs);
+    }
+#endif
+  }
+#ifdef ENABLE_PIPELINE_STATS
+  if (deviceConnected && halStatusSubscribed() && now - lastStatsNotify >= PIPELINE_STATS_NOTIFY_MS) {
+    uint8_t buffer[STATS_FRAME_MAX];
+    size_t length = appStatsFrame(buffer, sizeof(buffer));
+    halNotifyStatus(buffer, length);
+    lastStatsNotify = now;
+  }
+#endif
+  serviceLink(now);
+  return newFrame;
+}
+
+uint32_t appNextWakeMs() {
+  if (displayNeedsUpdate || linkChanged) return 0;
+  uint32_t now = halMillis();
+  uint32_t wait = APP_WAIT_FOREVER;
+  if (deviceConnected) {
+    uint32_t linkWait = linkTuner.nextPollMs(now);
+    if (linkWait < wait) wait = linkWait;
+  }
+  if (displayScrolling()) {
+    // Not paced yet means the marquee just started; appLoop sets the grid
+    int32_t untilFrame = scrollPaced ? (int32_t)(nextScrollFrame - now) : 0;
+    uint32_t frameWait = untilFrame > 0 ? untilFrame : 0;
+    if (frameWait < wait) wait = frameWait;
+  }
+#ifdef ENABLE_PIPELINE_STATS
+  if (deviceConnected && halStatusSubscribed()) {
+    int32_t untilNotify = (int32_t)(lastStatsNotify + PIPELINE_STATS_NOTIFY_MS - now);
+    uint32_t notifyWait = untilNotify > 0 ? untilNotify : 0;
+    if (notifyWait < wait) wait = notifyWait;
+  }
+#endif
+  return wait;
+}
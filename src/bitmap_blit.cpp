@@ -0,0 +1,80 @@
+#include "bitmap_blit.h"
+
+// bitSpread rows, built by the compiler: bit i of v becomes `scale` bits
+// at i * scale
+static constexpr uint32_t spreadBits(uint32_t v, uint32_t scale, uint32_t bit = 0) {
+  return bit == 8 ? 0 : (((v >> bit) & 1) ? ((1u << scale) - 1) << (bit * scale) : 0) | spreadBits(v, scale, bit + 1);
+}
+#define SPREAD4(s, v)   spreadBits((v), s), spreadBits((v) + 1, s), spreadBits((v) + 2, s), spreadBits((v) + 3, s)
+#define SPREAD16(s, v)  SPREAD4(s, v), SPREAD4(s, (v) + 4), SPREAD4(s, (v) + 8), SPREAD4(s, (v) + 12)
+#define SPREAD64(s, v)  SPREAD16(s, v), SPREAD16(s, (v) + 16), SPREAD16(s, (v) + 32), SPREAD16(s, (v) + 48)
+#define SPREAD256(s)    SPREAD64(s, 0), SPREAD64(s, 64), SPREAD64(s, 128), SPREAD64(s, 192)
+
+const uint32_t bitSpread[BLIT_MAX_SCALE][256] = {
+  {SPREAD256(1)},
+  {SPREAD256(2)},
+  {SPREAD256(3)},
+};
+
+// Eight bits starting at bit `pos`, MSB first
+static inline uint8_t readBits8(const uint8_t* bitmap, uint32_t pos, uint32_t totalBytes) {
+  uint32_t index = pos >> 3;
+  uint8_t shift = pos & 7;
+  uint8_t value = bitmap[index] << shift;
+  if (shift && index + 1 < totalBytes) value |= bitmap[index + 1] >> (8 - shift);
+  return value;
+}
+
+void blitToPages(uint8_t* buffer, int16_t bufferWidth, int16_t bufferHeight,
+                 int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h) {
+  const uint32_t totalBytes = ((uint32_t)w * h + 7) / 8;
+  const int16_t pages = (bufferHeight + 7) / 8;
+
+  for (int16_t r0 = 0; r0 < h; r0 += 8) {
+    const int16_t rowCount = h - r0 < 8 ? h - r0 : 8;
+    const int16_t dy = y + r0;
+    const int16_t page = dy >= 0 ? dy / 8 : -((7 - dy) / 8);
+    const uint8_t shift = dy - page * 8;
+    if (page + 1 < 0 || page >= pages) continue;
+
+    for (int16_t c0 = 0; c0 < w; c0 += 8) {
+      const int16_t colCount = w - c0 < 8 ? w - c0 : 8;
+      const uint8_t colMask = 0xFF << (8 - colCount);
+      uint8_t rows[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+      uint8_t any = 0;
+      for (int16_t k = 0; k < rowCount; k++) {
+        rows[k] = readBits8(bitmap, (uint32_t)(r0 + k) * w + c0, totalBytes) & colMask;
+        any |= rows[k];
+      }
+      if (!any) continue;
+
+      uint8_t cols[8];
+      transpose8(rows, cols);
+      for (int16_t b = 0; b < colCount; b++) {
+        const int16_t dx = x + c0 + b;
+        if (!cols[b] || dx < 0 || dx >= bufferWidth) continue;
+        if (page >= 0) buffer[page * bufferWidth + dx] |= cols[b] << shift;
+        if (shift && page + 1 < pages) buffer[(page + 1) * bufferWidth + dx] |= cols[b] >> (8 - shift);
+      }
+    }
+  }
+}
+
+void expandBits565(const uint8_t* bitmap, uint32_t bitPos, uint32_t count,
+                   uint16_t* dst, uint16_t fg, uint16_t bg) {
+  const uint32_t totalBytes = (bitPos + count + 7) / 8;
+  while (count >= 8) {
+    uint8_t bits = readBits8(bitmap, bitPos, totalBytes);
+    for (int b = 7; b >= 0; b--) {
+      *dst++ = (bits >> b) & 1 ? fg : bg;
+    }
+    bitPos += 8;
+    count -= 8;
+  }
+  if (count) {
+    uint8_t bits = readBits8(bitmap, bitPos, totalBytes);
+    for (uint32_t b = 0; b < count; b++) {
+      *dst++ = (bits << b) & 0x80 ? fg : bg;
+    }
+  }
+}
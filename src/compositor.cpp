@@ -0,0 +1,45 @@
+#include "compositor.h"
+
+void Rect::unite(const Rect& other) {
+  if (other.empty()) return;
+  if (empty()) {
+    *this = other;
+    return;
+  }
+  int16_t right = x + w > other.x + other.w ? x + w : other.x + other.w;
+  int16_t bottom = y + h > other.y + other.h ? y + h : other.y + other.h;
+  x = x < other.x ? x : other.x;
+  y = y < other.y ? y : other.y;
+  w = right - x;
+  h = bottom - y;
+}
+
+uint8_t Compositor::resolve() const {
+  uint8_t repaint = changed_;
+  bool grew = true;
+  while (grew) {
+    grew = false;
+    for (uint8_t i = 0; i < count_; i++) {
+      if (!(repaint & (1u << i))) continue;
+      for (uint8_t j = 0; j < count_; j++) {
+        if (repaint & (1u << j)) continue;
+        // An opaque repaint leaves the widgets below it alone
+        if (isOpaque(i) && j < i) continue;
+        if (rects_[i].intersects(rects_[j])) {
+          repaint |= 1u << j;
+          grew = true;
+        }
+      }
+    }
+  }
+  return repaint;
+}
+
+Rect Compositor::damage() const {
+  uint8_t repaint = resolve();
+  Rect bounds = {0, 0, 0, 0};
+  for (uint8_t i = 0; i < count_; i++) {
+    if (repaint & (1u << i)) bounds.unite(rects_[i]);
+  }
+  return bounds;
+}
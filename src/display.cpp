@@ -0,0 +1,490 @@
+#include "display.h"
+
+#include <string.h>
+#include <clib/u8g2.h>
+#include "hal.h"
+#include "bitmap_blit.h"
+#include "compositor.h"
+#include "icon_cache.h"
+#include "myfont.h"
+#include "text_layout.h"
+#include "disconnected_icon_9.h"
+#include "fixed_string.h"
+#include "glyph_cache.h"
+
+#ifdef USE_TFT_ST7789
+  #define DISPLAY_COLOR_WHITE 0xFFFF
+  #define DISPLAY_COLOR_BLACK 0x0000
+  #define DISPLAY_COLOR_GREEN 0x07E0
+  #define DISPLAY_COLOR_RED 0xF800
+#endif
+#ifdef USE_OLED_GME128128
+  #define DISPLAY_COLOR_WHITE 1
+  #define DISPLAY_COLOR_BLACK 0
+  #define DISPLAY_COLOR_GREEN 1
+  #define DISPLAY_COLOR_RED 1
+#endif
+
+extern const uint8_t u8g2_font_unifont_t_vietnamese2[15330] U8G2_FONT_SECTION("u8g2_font_unifont_t_vietnamese2");
+extern const uint8_t u8g2_font_inr33_mf[11616] U8G2_FONT_SECTION("u8g2_font_inr33_mf");
+extern const uint8_t u8g2_font_helvB18_tf[4956] U8G2_FONT_SECTION("u8g2_font_helvB18_tf");
+extern const uint8_t u8g2_font_unifont_t_vietnamese1[4308] U8G2_FONT_SECTION("u8g2_font_unifont_t_vietnamese1");
+
+// Scrolling state
+static bool isScrolling = false;
+static uint32_t scrollStartTime = 0;
+static int16_t scrollTextWidth = 0;
+
+#ifdef USE_TFT_ST7789
+// u8g2 core used for its fonts only: glyphs come out as h/v lines that go
+// straight to the panel, so there is no buffer behind it
+static u8g2_t tftText;
+static u8x8_display_info_t tftTextInfo;
+static uint16_t tftTextColor;
+static TextLayoutCache tftLayouts;
+
+static uint8_t tftTextDisplay(u8x8_t* u8x8, uint8_t msg, uint8_t, void*) {
+  if (msg == U8X8_MSG_DISPLAY_SETUP_MEMORY) u8x8_d_helper_display_setup_memory(u8x8, &tftTextInfo);
+  return 1;
+}
+
+static void tftTextLine(u8g2_t*, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir) {
+  if (dir == 0) {
+    halTftFillRect(x, y, len, 1, tftTextColor);
+  } else {
+    halTftFillRect(x, y, 1, len, tftTextColor);
+  }
+}
+#endif
+
+#ifdef USE_OLED_GME128128
+// A title too wide for the panel is rasterized once into this strip, laid
+// out like the panel buffer (one byte per column per 8-row page). Each
+// scroll tick ORs a shifted window of it into the page buffer.
+#define MARQUEE_MAX_WIDTH 1024
+#define MARQUEE_PAGES     4
+static u8g2_t marqueeText;
+static u8x8_display_info_t marqueeInfo;
+static uint8_t marqueeStrip[MARQUEE_PAGES * MARQUEE_MAX_WIDTH];
+static struct {
+  FixedString<NAV_TITLE_MAX> text;
+  const uint8_t* font;
+  int16_t y;      // baseline on the panel
+  int16_t top;    // panel row of the strip's first page
+  int16_t width;  // 0 while the strip holds nothing
+} marquee;
+
+static uint8_t marqueeDisplay(u8x8_t* u8x8, uint8_t msg, uint8_t, void*) {
+  if (msg == U8X8_MSG_DISPLAY_SETUP_MEMORY) u8x8_d_helper_display_setup_memory(u8x8, &marqueeInfo);
+  return 1;
+}
+
+static bool marqueeHolds(const char* text, const uint8_t* font, int16_t y) {
+  return marquee.width && marquee.font == font && marquee.y == y && marquee.text == text;
+}
+
+// Makes the strip hold `text`; false if it is too big for it
+static bool renderMarquee(const char* text, const uint8_t* font, int16_t y, int16_t top, int16_t bottom,
+                          int16_t width) {
+  if (marqueeHolds(text, font, y)) return true;
+  marquee.width = 0;
+  if (width > MARQUEE_MAX_WIDTH || (bottom - top + 7) / 8 > MARQUEE_PAGES) return false;
+  if (strlen(text) > marquee.text.capacity()) return false;
+
+  u8g2_ClearBuffer(&marqueeText);
+  u8g2_SetFont(&marqueeText, font);
+  drawGlyphString(&marqueeText, 0, y - top, text);
+  marquee.text = text;
+  marquee.font = font;
+  marquee.y = y;
+  marquee.top = top;
+  marquee.width = width;
+  scrollStartTime = 0;  // a new title starts from the beginning
+  return true;
+}
+
+// ORs the strip, drawn at drawX, into the page buffer within [x0, x1) x [y0, y1)
+static void blitMarquee(u8g2_t* oled, int16_t drawX, int16_t x0, int16_t x1, int16_t y0, int16_t y1) {
+  uint8_t* buffer = u8g2_GetBufferPtr(oled);
+  const int16_t stride = u8g2_GetBufferTileWidth(oled) * 8;
+  int16_t from = drawX > x0 ? drawX : x0;
+  int16_t to = drawX + marquee.width < x1 ? drawX + marquee.width : x1;
+  for (int16_t page = y0 / 8; page * 8 < y1; page++) {
+    uint8_t mask = 0xFF;
+    if (page * 8 < y0) mask &= (uint8_t)(0xFF << (y0 - page * 8));
+    if (page * 8 + 8 > y1) mask &= 0xFF >> (page * 8 + 8 - y1);
+    const uint8_t* src = marqueeStrip + (page - marquee.top / 8) * MARQUEE_MAX_WIDTH;
+    uint8_t* dst = buffer + page * stride;
+    for (int16_t col = from; col < to; col++) {
+      dst[col] |= src[col - drawX] & mask;
+    }
+  }
+}
+#endif
+
+void displayBegin() {
+  halDisplayBegin();
+#ifdef USE_TFT_ST7789
+  memset(&tftTextInfo, 0, sizeof(tftTextInfo));
+  tftTextInfo.tile_width = SCREEN_WIDTH / 8;
+  tftTextInfo.tile_height = SCREEN_HEIGHT / 8;
+  tftTextInfo.pixel_width = SCREEN_WIDTH;
+  tftTextInfo.pixel_height = SCREEN_HEIGHT;
+  u8x8_Setup(u8g2_GetU8x8(&tftText), tftTextDisplay, u8x8_cad_empty, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_SetupBuffer(&tftText, nullptr, SCREEN_HEIGHT / 8, tftTextLine, U8G2_R0);
+  u8g2_SetFontMode(&tftText, 1);
+#endif
+#ifdef USE_OLED_GME128128
+  memset(&marqueeInfo, 0, sizeof(marqueeInfo));
+  marqueeInfo.tile_width = MARQUEE_MAX_WIDTH / 8;
+  marqueeInfo.tile_height = MARQUEE_PAGES;
+  marqueeInfo.pixel_width = MARQUEE_MAX_WIDTH;
+  marqueeInfo.pixel_height = MARQUEE_PAGES * 8;
+  u8x8_Setup(u8g2_GetU8x8(&marqueeText), marqueeDisplay, u8x8_cad_empty, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_SetupBuffer(&marqueeText, marqueeStrip, MARQUEE_PAGES, u8g2_ll_hvline_vertical_top_lsb, U8G2_R0);
+  u8g2_SetDrawColor(&marqueeText, 1);
+  u8g2_SetFontMode(&marqueeText, 1);
+#endif
+}
+
+#ifdef USE_OLED_GME128128
+void drawBitmapScaled(u8g2_t* u8g2, int x, int y, const uint8_t *bitmap, int width, int height, int scale) {
+  if (!bitmap || scale < 1) return;
+
+  for (int row = 0; row < height; ++row) {
+    for (int col = 0; col < width; ++col) {
+      int byteIndex = row * ((width + 7) / 8) + (col / 8);
+      int bitMask = 0x80 >> (col % 8);
+      bool pixelOn = bitmap[byteIndex] & bitMask;
+
+      if (pixelOn) {
+        u8g2_DrawBox(u8g2, x + col * scale, y + row * scale, scale, scale);
+      }
+    }
+  }
+}
+#endif
+
+void drawBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h) {
+  if (!bitmap) {
+    halLog("Invalid bitmap: null pointer\n");
+    return;
+  }
+
+#if defined(USE_TFT_ST7789) && defined(USE_SPI_DMA)
+  // One address window for the whole bitmap, filled a few lines at a time
+  // from a buffer of lines expanded to RGB565
+  static uint16_t lineBuffer[TFT_BURST_LINES * SCREEN_WIDTH];
+  if (w > SCREEN_WIDTH) return;
+  halTftBeginWindow(x, y, w, h);
+  for (int16_t row = 0; row < h; row += TFT_BURST_LINES) {
+    int16_t lines = h - row < TFT_BURST_LINES ? h - row : TFT_BURST_LINES;
+    if (w == BITMAP_WIDTH) {
+      expandLines565Fixed<BITMAP_WIDTH, 1>(bitmap, row, lines, lineBuffer, DISPLAY_COLOR_WHITE,
+                                           DISPLAY_COLOR_BLACK);
+    } else {
+      expandBits565(bitmap, (uint32_t)row * w, (uint32_t)lines * w, lineBuffer, DISPLAY_COLOR_WHITE,
+                    DISPLAY_COLOR_BLACK);
+    }
+    halTftPushPixels(lineBuffer, (uint32_t)lines * w);
+  }
+  halTftEndWindow();
+#elif defined(USE_TFT_ST7789)
+  // TFT rendering (unchanged, 132x132)
+  for (int16_t j = 0; j < h; j++) {
+    int16_t startX = x;
+    int16_t lineStart = 0;
+    bool lastPixel = false;
+    for (int16_t i = 0; i < w; i++) {
+      int32_t pixelIndex = j * w + i;
+      int32_t byteIndex = pixelIndex / 8;
+      int32_t bitIndex = 7 - (pixelIndex % 8);
+      bool currentPixel = (bitmap[byteIndex] >> bitIndex) & 0x01;
+      if (currentPixel != lastPixel || i == w - 1) {
+        if (i == w - 1 && currentPixel == lastPixel) {
+          i++;
+        }
+        int16_t segmentWidth = i - lineStart;
+        if (segmentWidth > 0) {
+          uint16_t color = lastPixel ? DISPLAY_COLOR_WHITE : DISPLAY_COLOR_BLACK;
+          halTftFillRect(startX, y + j, segmentWidth, 1, color);
+        }
+        startX = x + i;
+        lineStart = i;
+        lastPixel = currentPixel;
+      }
+    }
+  }
+#endif
+#ifdef USE_OLED_GME128128
+  // Write straight into the page buffer instead of one drawPixel per pixel
+  u8g2_t* oled = halOled();
+  if (w == BITMAP_WIDTH && h == BITMAP_HEIGHT) {
+    blitPagesFixed<BITMAP_WIDTH, BITMAP_HEIGHT, 1>(u8g2_GetBufferPtr(oled), u8g2_GetBufferTileWidth(oled) * 8,
+                                                   u8g2_GetBufferTileHeight(oled) * 8, x, y, bitmap);
+  } else {
+    blitToPages(u8g2_GetBufferPtr(oled), u8g2_GetBufferTileWidth(oled) * 8, u8g2_GetBufferTileHeight(oled) * 8,
+                x, y, bitmap, w, h);
+  }
+#endif
+}
+
+void drawUnicodeString(int16_t x, int16_t y, const char *text, uint16_t color, const uint8_t *font) {
+#ifdef USE_TFT_ST7789
+  u8g2_SetFont(&tftText, font);
+  tftTextColor = color;
+  const int16_t lineHeight = u8g2_GetAscent(&tftText) - u8g2_GetDescent(&tftText);
+  const TextLayout& layout = tftLayouts.get(&tftText, text, SCREEN_WIDTH - x);
+  for (uint8_t i = 0; i < layout.lineCount; i++) {
+    drawTextLine(&tftText, x, y + i * (lineHeight + LINE_SPACING_OFFSET), text, layout.lines[i]);
+  }
+#endif
+#ifdef USE_OLED_GME128128
+  u8g2_t* oled = halOled();
+  u8g2_SetFont(oled, font);
+  u8g2_SetDrawColor(oled, color);
+  // Scroll ticks reuse the width measured when the strip was rendered
+  int16_t textWidth = marqueeHolds(text, font, y) ? marquee.width : glyphStringWidth(oled, text);
+  const int16_t maxWidth = SCREEN_WIDTH - x; // 126 at x=2
+
+  if (textWidth <= maxWidth) {
+    // Static text
+    drawGlyphString(oled, x, y, text);
+    isScrolling = false;
+  } else {
+    // Scrolling text
+    int16_t clipTop = y - u8g2_GetAscent(oled) - 6;
+    int16_t clipBottom = y + u8g2_GetDescent(oled) + 6;
+    if (clipTop < 0) clipTop = 0;
+    if (clipBottom > SCREEN_HEIGHT) clipBottom = SCREEN_HEIGHT;
+    bool prerendered = color == 1 && renderMarquee(text, font, y, clipTop & ~7, clipBottom, textWidth);
+    isScrolling = true;
+    scrollTextWidth = textWidth;
+    if (scrollStartTime == 0) {
+      scrollStartTime = halMillis();
+    }
+    // Scroll right to left, 5s cycle
+    uint32_t elapsed = halMillis() - scrollStartTime;
+    // Add 500ms pause at start
+    int16_t offset;
+    if (elapsed < 500) {
+      offset = 0; // Pause
+    } else {
+      uint32_t scrollTime = elapsed - 500;
+      offset = (scrollTime % 8000) * (textWidth + SCREEN_WIDTH) / 8000;
+    }
+    int16_t drawX = SCREEN_WIDTH - offset;
+    if (prerendered) {
+      blitMarquee(oled, drawX, x, x + maxWidth, clipTop, clipBottom);
+    } else {
+      u8g2_SetClipWindow(oled, x, clipTop, x + maxWidth, clipBottom);
+      drawGlyphString(oled, drawX, y, text);
+      u8g2_SetMaxClipWindow(oled); // Reset clip
+    }
+  }
+#endif
+}
+
+bool displayScrolling() {
+  return isScrolling;
+}
+
+// Screen widgets, in draw order
+enum Widget : uint8_t {
+  WIDGET_STATUS,
+  WIDGET_BITMAP,
+  WIDGET_DISTANCE,
+  WIDGET_TITLE,
+  WIDGET_ETA,
+  WIDGET_COUNT
+};
+
+// Connected layout: the area each widget may touch, text ascent/descent included.
+// Nothing overlaps the title, so a marquee tick repaints the title alone.
+#ifdef USE_TFT_ST7789
+static const Rect widgetRects[WIDGET_COUNT] = {
+  {0, 0, SCREEN_WIDTH, STATUS_BAR_HEIGHT},                                    // status bar
+  {(SCREEN_WIDTH - BITMAP_WIDTH) / 2, 2, BITMAP_WIDTH, BITMAP_HEIGHT},        // bitmap
+  {0, BITMAP_HEIGHT + STATUS_BAR_HEIGHT - 10, SCREEN_WIDTH, 60},              // distance, baseline 200
+  {0, 218, SCREEN_WIDTH, SCREEN_HEIGHT - 218},                                // title, wraps from baseline 240
+  {0, 284, SCREEN_WIDTH, SCREEN_HEIGHT - 284},                                // eta, baseline 304
+};
+static Compositor compositor(widgetRects, WIDGET_COUNT, (1 << WIDGET_STATUS) | (1 << WIDGET_BITMAP));
+#endif
+#ifdef USE_OLED_GME128128
+static const Rect widgetRects[WIDGET_COUNT] = {
+  {0, 0, 0, 0},                              // no status bar while connected
+  {2, 2, BITMAP_WIDTH, BITMAP_HEIGHT},       // bitmap
+  {0, 82, SCREEN_WIDTH, 22},                 // distance, baseline 102, descenders clipped at 104
+  {0, 104, SCREEN_WIDTH, SCREEN_HEIGHT - 104},  // title, baseline 124; the marquee clips to 108-127
+  {0, 0, 0, 0},                              // eta is not shown
+};
+static Compositor compositor(widgetRects, WIDGET_COUNT);
+#endif
+
+// What the screen currently shows, diffed against each new frame
+static struct {
+  bool valid;
+  bool connected;
+  bool hasBitmap;
+  uint32_t bitmapHash;
+  FixedString<NAV_TITLE_MAX> title;
+  FixedString<NAV_FIELD_MAX> eta;
+  FixedString<NAV_FIELD_MAX> distance;
+} shown;
+
+static void clearWidget(uint8_t widget) {
+  const Rect& r = compositor.rect(widget);
+  if (r.empty() || compositor.isOpaque(widget)) return;
+#ifdef USE_TFT_ST7789
+  halTftFillRect(r.x, r.y, r.w, r.h, DISPLAY_COLOR_BLACK);
+#endif
+#ifdef USE_OLED_GME128128
+  u8g2_t* oled = halOled();
+  u8g2_SetDrawColor(oled, 0);
+  u8g2_DrawBox(oled, r.x, r.y, r.w, r.h);
+  u8g2_SetDrawColor(oled, 1);
+#endif
+}
+
+static void drawWidget(uint8_t widget, const NavFrame& nav) {
+  const Rect& r = compositor.rect(widget);
+  const uint8_t* bitmapData = nav.hasBitmap ? nav.bitmap : nullptr;
+  switch (widget) {
+#ifdef USE_TFT_ST7789
+    case WIDGET_STATUS:
+      halTftFillRect(r.x, r.y, r.w, r.h, DISPLAY_COLOR_GREEN);
+      drawUnicodeString(5, 20, "Connected", DISPLAY_COLOR_BLACK, u8g2_font_unifont_t_vietnamese2);
+      break;
+    case WIDGET_BITMAP:
+      if (bitmapData) {
+        drawBitmap(r.x, r.y, bitmapData, BITMAP_WIDTH, BITMAP_HEIGHT);
+      } else {
+        halTftFillRect(r.x, r.y, r.w, r.h, DISPLAY_COLOR_BLACK);
+      }
+      break;
+    case WIDGET_DISTANCE:
+      drawUnicodeString((SCREEN_WIDTH - BITMAP_WIDTH) / 2, 200, nav.distance.c_str(), DISPLAY_COLOR_GREEN, u8g2_font_inr33_mf);
+      break;
+    case WIDGET_TITLE:
+      drawUnicodeString(5, 240, nav.title.c_str(), DISPLAY_COLOR_WHITE, myfont);
+      break;
+    case WIDGET_ETA:
+      drawUnicodeString(5, 304, nav.eta.c_str(), DISPLAY_COLOR_WHITE, myfont);
+      break;
+#endif
+#ifdef USE_OLED_GME128128
+    case WIDGET_BITMAP:
+      if (bitmapData) drawBitmap(r.x, r.y, bitmapData, BITMAP_WIDTH, BITMAP_HEIGHT);
+      break;
+    case WIDGET_DISTANCE: {
+      // Centred on the ETA width, as before
+      int etaX = 20;
+      int etaWidth = SCREEN_WIDTH - etaX - 2;
+      u8g2_SetFont(halOled(), u8g2_font_helvB18_tf);
+      int textWidth = glyphStringWidth(halOled(), nav.eta.c_str());
+      int textX = etaX + (etaWidth - textWidth) / 2;
+      u8g2_SetClipWindow(halOled(), r.x, r.y, r.x + r.w, r.y + r.h);
+      drawUnicodeString(textX, 2 + BITMAP_WIDTH + 10, nav.distance.c_str(), DISPLAY_COLOR_WHITE, u8g2_font_helvB18_tf);
+      u8g2_SetMaxClipWindow(halOled());
+      break;
+    }
+    case WIDGET_TITLE:
+      drawUnicodeString(0, 124, nav.title.c_str(), DISPLAY_COLOR_WHITE, u8g2_font_unifont_t_vietnamese1);
+      break;
+#endif
+    default:
+      break;
+  }
+}
+
+static void drawDisconnected() {
+  isScrolling = false;
+#ifdef USE_TFT_ST7789
+  halTftFillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, DISPLAY_COLOR_BLACK);
+  halTftFillRect(0, 0, SCREEN_WIDTH, STATUS_BAR_HEIGHT, DISPLAY_COLOR_RED);
+  drawUnicodeString(5, 20, "Disconnected", DISPLAY_COLOR_WHITE, u8g2_font_unifont_t_vietnamese2);
+  drawBitmap(54, 70, disconnected_icon_9, BITMAP_WIDTH, BITMAP_HEIGHT);
+#endif
+#ifdef USE_OLED_GME128128
+  u8g2_t* oled = halOled();
+  u8g2_ClearBuffer(oled);
+  u8g2_DrawBox(oled, 0, 0, SCREEN_WIDTH, STATUS_BAR_HEIGHT);
+  drawUnicodeString(5, 14, "Disconnected", DISPLAY_COLOR_BLACK, u8g2_font_helvB12_tf);
+  drawBitmap(19, 39, disconnected_icon_90, BITMAP_WIDTH, BITMAP_HEIGHT);
+  u8g2_SendBuffer(oled);
+#endif
+}
+
+// Diffs the front frame against what is shown and repaints only the
+// widgets that changed, plus any they overlap
+void updateDisplay(const NavFrame& nav, bool connected) {
+  if (!shown.valid || shown.connected != connected) {
+    shown.valid = true;
+    shown.connected = connected;
+    compositor.clear();
+    if (!connected) {
+      drawDisconnected();
+      return;
+    }
+#ifdef USE_TFT_ST7789
+    halTftFillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, DISPLAY_COLOR_BLACK);
+#endif
+#ifdef USE_OLED_GME128128
+    u8g2_ClearBuffer(halOled());
+#endif
+    compositor.invalidateAll();
+  }
+  if (!connected) {
+    compositor.clear();
+    return;
+  }
+
+  uint32_t bitmapHash = nav.hasBitmap ? IconCache::hash(nav.bitmap) : 0;
+  if (nav.hasBitmap != shown.hasBitmap || bitmapHash != shown.bitmapHash) {
+    compositor.invalidate(WIDGET_BITMAP);
+    shown.hasBitmap = nav.hasBitmap;
+    shown.bitmapHash = bitmapHash;
+  }
+  if (nav.distance != shown.distance) {
+    compositor.invalidate(WIDGET_DISTANCE);
+    shown.distance = nav.distance;
+  }
+  if (nav.title != shown.title) {
+    compositor.invalidate(WIDGET_TITLE);
+    shown.title = nav.title;
+  }
+  if (nav.eta != shown.eta) {
+    compositor.invalidate(WIDGET_ETA);
+#ifdef USE_OLED_GME128128
+    compositor.invalidate(WIDGET_DISTANCE);  // distance is positioned by the ETA width
+#endif
+    shown.eta = nav.eta;
+  }
+  if (!compositor.pending()) return;
+
+  uint8_t repaint = compositor.resolve();
+  for (uint8_t i = 0; i < WIDGET_COUNT; i++) {
+    if (repaint & (1u << i)) clearWidget(i);
+  }
+  for (uint8_t i = 0; i < WIDGET_COUNT; i++) {
+    if (repaint & (1u << i)) drawWidget(i, nav);
+  }
+
+#ifdef USE_OLED_GME128128
+  // Only the tiles covering repainted widgets can differ from the panel
+  Rect damage = compositor.damage();
+  int16_t x0 = damage.x < 0 ? 0 : damage.x;
+  int16_t y0 = damage.y < 0 ? 0 : damage.y;
+  int16_t x1 = damage.x + damage.w > SCREEN_WIDTH ? SCREEN_WIDTH : damage.x + damage.w;
+  int16_t y1 = damage.y + damage.h > SCREEN_HEIGHT ? SCREEN_HEIGHT : damage.y + damage.h;
+  if (x1 > x0 && y1 > y0) {
+    u8g2_UpdateDisplayArea(halOled(), x0 / 8, y0 / 8, (x1 + 7) / 8 - x0 / 8, (y1 + 7) / 8 - y0 / 8);
+  }
+#endif
+  compositor.clear();
+}
+
+void displayScrollTick() {
+  compositor.invalidate(WIDGET_TITLE);
+}
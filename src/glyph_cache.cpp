@@ -0,0 +1,226 @@
+#include "glyph_cache.h"
+
+#include <string.h>
+#include "fixed_string.h"
+
+GlyphCache glyphCache;
+
+// u8g2 font header (see u8g2_font.c)
+#define FONT_HEADER_LEN 23
+#define FONT_BITS_PER_0 2
+#define FONT_BITS_PER_1 3
+#define FONT_BITS_WIDTH 4
+#define FONT_BITS_HEIGHT 5
+#define FONT_BITS_X 6
+#define FONT_BITS_Y 7
+#define FONT_BITS_ADVANCE 8
+#define FONT_START_UPPER_A 17
+#define FONT_START_LOWER_A 19
+#define FONT_START_UNICODE 21
+
+static uint16_t readWord(const uint8_t* p) {
+  return (uint16_t)p[0] << 8 | p[1];
+}
+
+// Glyph data after its encoding and size bytes, or nullptr
+static const uint8_t* findGlyph(const uint8_t* font, uint16_t encoding) {
+  const uint8_t* p = font + FONT_HEADER_LEN;
+  if (encoding <= 0xFF) {
+    if (encoding >= 'a') {
+      p += readWord(font + FONT_START_LOWER_A);
+    } else if (encoding >= 'A') {
+      p += readWord(font + FONT_START_UPPER_A);
+    }
+    for (; p[1] != 0; p += p[1]) {
+      if (p[0] == encoding) return p + 2;
+    }
+    return nullptr;
+  }
+
+  // The lookup table jumps close to the glyph; the rest is a linear scan
+  uint16_t unicodeStart = readWord(font + FONT_START_UNICODE);
+  if (unicodeStart == 0) return nullptr;  // no glyphs above 0xFF
+  p += unicodeStart;
+  const uint8_t* table = p;
+  uint16_t tableEncoding;
+  do {
+    uint16_t jump = readWord(table);
+    tableEncoding = readWord(table + 2);
+    if (jump == 0) return nullptr;
+    p += jump;
+    table += 4;
+  } while (tableEncoding < encoding);
+  for (uint16_t e; (e = readWord(p)) != 0; p += p[2]) {
+    if (e == encoding) return p + 3;
+  }
+  return nullptr;
+}
+
+// LSB-first bit reader over the glyph data
+struct FontBits {
+  const uint8_t* p;
+  uint8_t pos;
+
+  uint8_t get(uint8_t count) {
+    uint8_t value = p[0] >> pos;
+    uint8_t end = pos + count;
+    if (end >= 8) {
+      p++;
+      value |= p[0] << (8 - pos);
+      end -= 8;
+    }
+    pos = end;
+    return value & ((1u << count) - 1);
+  }
+
+  int8_t getSigned(uint8_t count) {
+    return (int8_t)(get(count) - (1 << (count - 1)));
+  }
+};
+
+bool fontDecodeGlyph(const uint8_t* font, uint16_t encoding, Glyph& glyph, bool withRuns) {
+  glyph.font = font;
+  glyph.encoding = encoding;
+  glyph.found = false;
+  glyph.fallback = false;
+  glyph.hasRuns = false;
+  glyph.advance = 0;
+  glyph.width = glyph.height = 0;
+  glyph.xOffset = glyph.yOffset = 0;
+  glyph.runCount = 0;
+
+  const uint8_t* data = findGlyph(font, encoding);
+  if (!data) return false;
+  FontBits bits = {data, 0};
+  glyph.width = bits.get(font[FONT_BITS_WIDTH]);
+  glyph.height = bits.get(font[FONT_BITS_HEIGHT]);
+  glyph.xOffset = bits.getSigned(font[FONT_BITS_X]);
+  glyph.yOffset = bits.getSigned(font[FONT_BITS_Y]);
+  glyph.advance = bits.getSigned(font[FONT_BITS_ADVANCE]);
+  glyph.found = true;
+  if (!withRuns) return true;
+
+  // Each pair of run lengths is followed by 1 bits, one per repeat
+  uint32_t pixels = (uint32_t)glyph.width * glyph.height;
+  uint32_t pixel = 0;
+  while (pixel < pixels) {
+    uint8_t background = bits.get(font[FONT_BITS_PER_0]);
+    uint8_t foreground = bits.get(font[FONT_BITS_PER_1]);
+    do {
+      if (glyph.runCount == GLYPH_RUNS_MAX) return true;
+      glyph.runs[glyph.runCount][0] = background;
+      glyph.runs[glyph.runCount][1] = foreground;
+      glyph.runCount++;
+      pixel += background + foreground;
+    } while (bits.get(1));
+  }
+  glyph.hasRuns = true;
+  return true;
+}
+
+GlyphCache::GlyphCache() : clock_(0), hits_(0), misses_(0) {
+  memset(entries_, 0, sizeof(entries_));
+  memset(buckets_, NONE, sizeof(buckets_));
+}
+
+uint8_t GlyphCache::bucketOf(const uint8_t* font, uint16_t encoding) {
+  uint32_t h = (uint32_t)(uintptr_t)font * 31 + encoding;
+  return (h ^ (h >> 7)) % GLYPH_CACHE_ENTRIES;
+}
+
+void GlyphCache::unlink(uint8_t slot) {
+  const Glyph& glyph = entries_[slot].glyph;
+  uint8_t* link = &buckets_[bucketOf(glyph.font, glyph.encoding)];
+  while (*link != NONE && *link != slot) link = &entries_[*link].next;
+  if (*link == slot) *link = entries_[slot].next;
+}
+
+const Glyph& GlyphCache::get(const uint8_t* font, uint16_t encoding) {
+  uint8_t bucket = bucketOf(font, encoding);
+  for (uint8_t i = buckets_[bucket]; i != NONE; i = entries_[i].next) {
+    Glyph& glyph = entries_[i].glyph;
+    if (glyph.font == font && glyph.encoding == encoding) {
+      entries_[i].lastUse = ++clock_;
+      hits_++;
+      return glyph;
+    }
+  }
+
+  misses_++;
+  uint8_t victim = 0;
+  for (uint8_t i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+    if (entries_[i].lastUse < entries_[victim].lastUse) victim = i;
+  }
+  if (entries_[victim].lastUse != 0) unlink(victim);
+  Entry& entry = entries_[victim];
+  if (!fontDecodeGlyph(font, encoding, entry.glyph)) {
+    entry.glyph.fallback = fontDecodeGlyph(font, GLYPH_FALLBACK, entry.glyph);
+    // Still filed under the code point that was asked for
+    entry.glyph.encoding = encoding;
+  }
+  entry.lastUse = ++clock_;
+  entry.next = buckets_[bucket];
+  buckets_[bucket] = victim;
+  return entry.glyph;
+}
+
+// Draws `count` pixels from (col, row) of the glyph box, wrapping at its
+// width, and moves past them
+static void drawRun(u8g2_t* u8g2, const Glyph& glyph, int16_t left, int16_t top, uint8_t& col, uint8_t& row,
+                    uint8_t count, bool draw) {
+  while (count && row < glyph.height) {
+    uint8_t n = glyph.width - col < count ? glyph.width - col : count;
+    if (draw) u8g2_DrawHLine(u8g2, left + col, top + row, n);
+    count -= n;
+    col += n;
+    if (col == glyph.width) {
+      col = 0;
+      row++;
+    }
+  }
+}
+
+int16_t drawGlyph(u8g2_t* u8g2, int16_t x, int16_t y, uint16_t encoding) {
+  const Glyph& glyph = glyphCache.get(u8g2->font, encoding);
+  if (!glyph.found) return 0;
+  if (!glyph.hasRuns) return u8g2_DrawGlyph(u8g2, x, y, glyph.fallback ? GLYPH_FALLBACK : encoding);
+  if (glyph.width == 0) return glyph.advance;
+
+  // The same h-lines u8g2's own decoder emits; in solid font mode the
+  // background runs are filled too
+  uint8_t color = u8g2->draw_color;
+  bool solid = !u8g2->font_decode.is_transparent;
+  int16_t left = x + glyph.xOffset;
+  int16_t top = y - glyph.height - glyph.yOffset;
+  uint8_t col = 0, row = 0;
+  for (uint8_t i = 0; i < glyph.runCount; i++) {
+    if (solid) u8g2_SetDrawColor(u8g2, color ^ 1);
+    drawRun(u8g2, glyph, left, top, col, row, glyph.runs[i][0], solid);
+    if (solid) u8g2_SetDrawColor(u8g2, color);
+    drawRun(u8g2, glyph, left, top, col, row, glyph.runs[i][1], true);
+  }
+  return glyph.advance;
+}
+
+int16_t drawGlyphString(u8g2_t* u8g2, int16_t x, int16_t y, const char* text) {
+  int16_t start = x;
+  while (*text) {
+    uint32_t cp = utf8Next(text);
+    if (cp <= 0xFFFF) x += drawGlyph(u8g2, x, y, cp);
+  }
+  return x - start;
+}
+
+int16_t glyphStringWidth(u8g2_t* u8g2, const char* text) {
+  int16_t width = 0;
+  int16_t lastInk = 0;  // ink edge minus advance of the last glyph
+  while (*text) {
+    uint32_t cp = utf8Next(text);
+    if (cp > 0xFFFF) continue;
+    const Glyph& glyph = glyphCache.get(u8g2->font, cp);
+    if (!glyph.found) continue;
+    width += glyph.advance;
+    lastInk = glyph.width ? glyph.width + glyph.xOffset - glyph.advance : 0;
+  }
+  return width + lastInk;
+}
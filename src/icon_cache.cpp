@@ -0,0 +1,83 @@
+#include "icon_cache.h"
+
+#include <string.h>
+#include "nav_protocol.h"
+
+#if defined(ICON_CACHE_PERSIST) && defined(ARDUINO)
+#include <Preferences.h>
+#include <stdio.h>
+#endif
+
+IconCache::IconCache() : clock_(0), hits_(0) {
+  memset(entries_, 0, sizeof(entries_));
+}
+
+uint32_t IconCache::hash(const uint8_t* bitmap) {
+  return navCrc32(0, bitmap, BITMAP_BYTES);
+}
+
+const uint8_t* IconCache::find(uint32_t key) {
+  for (size_t i = 0; i < ICON_CACHE_ENTRIES; i++) {
+    if (entries_[i].lastUse != 0 && entries_[i].key == key) {
+      entries_[i].lastUse = ++clock_;
+      hits_++;
+      return entries_[i].bitmap;
+    }
+  }
+  return nullptr;
+}
+
+void IconCache::insert(uint32_t key, const uint8_t* bitmap) {
+  size_t victim = 0;
+  for (size_t i = 0; i < ICON_CACHE_ENTRIES; i++) {
+    if (entries_[i].lastUse != 0 && entries_[i].key == key) {
+      entries_[i].lastUse = ++clock_;
+      return;
+    }
+    if (entries_[i].lastUse < entries_[victim].lastUse) victim = i;
+  }
+  entries_[victim].key = key;
+  entries_[victim].lastUse = ++clock_;
+  memcpy(entries_[victim].bitmap, bitmap, BITMAP_BYTES);
+  save(victim);
+}
+
+#if defined(ICON_CACHE_PERSIST) && defined(ARDUINO)
+// One NVS key pair per slot: "k<n>" holds the hash, "b<n>" the bitmap. The
+// hash goes last and is removed first, so a reset in between leaves the
+// slot without one rather than with another icon's.
+void IconCache::save(size_t slot) {
+  char hashKey[4];
+  char bitmapKey[4];
+  snprintf(hashKey, sizeof(hashKey), "k%u", (unsigned)slot);
+  snprintf(bitmapKey, sizeof(bitmapKey), "b%u", (unsigned)slot);
+  Preferences prefs;
+  prefs.begin("icons", false);
+  prefs.remove(hashKey);
+  if (prefs.putBytes(bitmapKey, entries_[slot].bitmap, BITMAP_BYTES) == BITMAP_BYTES) {
+    prefs.putUInt(hashKey, entries_[slot].key);
+  }
+  prefs.end();
+}
+
+void IconCache::load() {
+  char key[4];
+  Preferences prefs;
+  prefs.begin("icons", true);
+  for (size_t i = 0; i < ICON_CACHE_ENTRIES; i++) {
+    snprintf(key, sizeof(key), "k%u", (unsigned)i);
+    if (!prefs.isKey(key)) continue;
+    entries_[i].key = prefs.getUInt(key);
+    snprintf(key, sizeof(key), "b%u", (unsigned)i);
+    // Flash that went bad or an interrupted save must not pass for a hit
+    if (prefs.getBytes(key, entries_[i].bitmap, BITMAP_BYTES) == BITMAP_BYTES &&
+        hash(entries_[i].bitmap) == entries_[i].key) {
+      entries_[i].lastUse = ++clock_;
+    }
+  }
+  prefs.end();
+}
+#else
+void IconCache::save(size_t) {}
+void IconCache::load() {}
+#endif
@@ -0,0 +1,153 @@
+#include "link_tuner.h"
+
+#include "nav_protocol.h"
+
+const LinkParams linkFastParams = {LINK_FAST_MIN_INTERVAL, LINK_FAST_MAX_INTERVAL, LINK_FAST_LATENCY,
+                                   LINK_TIMEOUT};
+const LinkParams linkRelaxedParams = {LINK_RELAXED_MIN_INTERVAL, LINK_RELAXED_MAX_INTERVAL, LINK_RELAXED_LATENCY,
+                                      LINK_TIMEOUT};
+
+void LinkTuner::connect(uint32_t now) {
+  disconnect();
+  connected_ = true;
+  phyRetryAt_ = now;
+  lastWrite_ = now;  // the app starts streaming as soon as it connects
+}
+
+void LinkTuner::disconnect() {
+  connected_ = false;
+  phy_ = PHY_WANTED;
+  phyAttempts_ = 0;
+  phyRetryAt_ = 0;
+  applied_ = LINK_PROFILE_NONE;
+  pending_ = LINK_PROFILE_NONE;
+  refused_ = LINK_PROFILE_NONE;
+  lastWrite_ = 0;
+  retryAt_ = 0;
+  retrying_ = false;
+}
+
+LinkProfile LinkTuner::wanted(uint32_t now) const {
+  if (!connected_) return LINK_PROFILE_NONE;
+  // Signed: the ingest task may stamp a write after the caller read `now`
+  return (int32_t)(now - lastWrite_) < (int32_t)LINK_IDLE_MS ? LINK_PROFILE_FAST : LINK_PROFILE_RELAXED;
+}
+
+LinkRequest LinkTuner::poll(uint32_t now) {
+  if (!connected_ || inFlight()) return LINK_REQUEST_NONE;
+  if (phy_ == PHY_WANTED && (int32_t)(now - phyRetryAt_) >= 0) return LINK_REQUEST_PHY_2M;
+  if (retrying_ && (int32_t)(now - retryAt_) < 0) return LINK_REQUEST_NONE;
+  LinkProfile profile = wanted(now);
+  if (profile == applied_ || profile == refused_) return LINK_REQUEST_NONE;
+  return profile == LINK_PROFILE_FAST ? LINK_REQUEST_FAST : LINK_REQUEST_RELAXED;
+}
+
+void LinkTuner::requested(LinkRequest request, bool sent, uint32_t now) {
+  switch (request) {
+    case LINK_REQUEST_PHY_2M:
+      if (sent) {
+        phy_ = PHY_PENDING;
+      } else {
+        phyFailed(now);
+      }
+      return;
+    case LINK_REQUEST_FAST:
+    case LINK_REQUEST_RELAXED:
+      retrying_ = !sent;
+      if (sent) {
+        pending_ = request == LINK_REQUEST_FAST ? LINK_PROFILE_FAST : LINK_PROFILE_RELAXED;
+        refused_ = LINK_PROFILE_NONE;
+      } else {
+        retryAt_ = now + LINK_RETRY_MS;
+      }
+      return;
+    default:
+      return;
+  }
+}
+
+void LinkTuner::paramsUpdated(bool ok, uint32_t now) {
+  (void)now;
+  if (pending_ == LINK_PROFILE_NONE) return;
+  if (ok) {
+    applied_ = pending_;
+  } else {
+    refused_ = pending_;
+  }
+  pending_ = LINK_PROFILE_NONE;
+}
+
+void LinkTuner::phyUpdated(bool on2M, uint32_t now) {
+  if (on2M) {
+    phy_ = PHY_2M;
+  } else if (phy_ == PHY_PENDING) {
+    phyFailed(now);
+  }
+}
+
+void LinkTuner::phyFailed(uint32_t now) {
+  if (++phyAttempts_ < LINK_PHY_ATTEMPTS) {
+    phy_ = PHY_WANTED;
+    phyRetryAt_ = now + LINK_PHY_RETRY_MS;
+  } else {
+    phy_ = PHY_REFUSED;
+  }
+}
+
+static uint32_t untilMs(uint32_t at, uint32_t now) {
+  int32_t until = (int32_t)(at - now);
+  return until > 0 ? until : 0;
+}
+
+uint32_t LinkTuner::nextPollMs(uint32_t now) const {
+  uint32_t wait = 0xFFFFFFFFu;
+  if (!connected_ || inFlight()) return wait;
+  if (phy_ == PHY_WANTED) wait = untilMs(phyRetryAt_, now);
+  if (retrying_) {
+    uint32_t untilRetry = untilMs(retryAt_, now);
+    return untilRetry < wait ? untilRetry : wait;
+  }
+  LinkProfile profile = wanted(now);
+  if (profile != applied_ && profile != refused_) return 0;
+  if (profile == LINK_PROFILE_FAST) {
+    // Going idle changes what is wanted
+    uint32_t untilIdle = untilMs(lastWrite_ + LINK_IDLE_MS, now);
+    if (untilIdle < wait) wait = untilIdle;
+  }
+  return wait;
+}
+
+const char* linkProfileName(LinkProfile profile) {
+  switch (profile) {
+    case LINK_PROFILE_FAST:    return "fast";
+    case LINK_PROFILE_RELAXED: return "relaxed";
+    default:                   return "none";
+  }
+}
+
+const char* linkRequestName(LinkRequest request) {
+  switch (request) {
+    case LINK_REQUEST_PHY_2M:  return "2M PHY";
+    case LINK_REQUEST_FAST:    return "fast";
+    case LINK_REQUEST_RELAXED: return "relaxed";
+    default:                   return "none";
+  }
+}
+
+size_t linkStatusFrame(const LinkState& state, LinkProfile profile, uint8_t* buffer, size_t capacity) {
+  NavFrameWriter writer(buffer, capacity, CMD_LINK_STATUS);
+  const uint8_t mtu[2] = {(uint8_t)state.mtu, (uint8_t)(state.mtu >> 8)};
+  writer.addField(LINK_TLV_MTU, mtu, sizeof(mtu));
+  const uint8_t phy[2] = {state.txPhy, state.rxPhy};
+  writer.addField(LINK_TLV_PHY, phy, sizeof(phy));
+  const uint16_t values[3] = {state.interval, state.latency, state.timeout};
+  uint8_t params[6];
+  for (uint8_t i = 0; i < 3; i++) {
+    params[i * 2] = (uint8_t)values[i];
+    params[i * 2 + 1] = (uint8_t)(values[i] >> 8);
+  }
+  writer.addField(LINK_TLV_PARAMS, params, sizeof(params));
+  const uint8_t p = profile;
+  writer.addField(LINK_TLV_PROFILE, &p, 1);
+  return writer.finish();
+}
@@ -1,378 +1,295 @@
 #include <Arduino.h>
 #include <SPI.h>
-#include "Adafruit_GFX.h"
+#include <stdarg.h>
 #include "config.h"
 
 #ifdef USE_TFT_ST7789
+#include "Adafruit_GFX.h"
 #include "Adafruit_ST7789.h"
-#include "U8g2_for_Adafruit_GFX.h"
-U8G2_FOR_ADAFRUIT_GFX u8g2;
+Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
 #endif
 #ifdef USE_OLED_GME128128
   #include <U8g2lib.h>
+U8G2_SH1107_SEEED_128X128_F_HW_I2C u8g2_oled(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
 #endif
 
 #include "NimBLEDevice.h"
-#include "myfont.h"
-#include "esp_crc.h"
-#include "disconnected_icon_9.h"
+#include "app.h"
+#include "fixed_string.h"
+#include "hal.h"
+#include "pipeline_stats.h"
+#include "trace.h"
 
+// BLE server state
+static NimBLEServer* pServer;
+static NimBLECharacteristic* pCharacteristic;
+static NimBLECharacteristic* pStatusCharacteristic;
+static NimBLECharacteristic* pTransferCharacteristic;
+static FixedString<18> connectedDeviceAddress;  // "aa:bb:cc:dd:ee:ff"
+static uint16_t connHandle = BLE_HS_CONN_HANDLE_NONE;
+
+#ifdef ENABLE_BLE_TRACE
+// One Serial line per record so the trace survives interleaved log output
+static void printTraceHex(const uint8_t* data, size_t length) {
+  static const char digits[] = "0123456789abcdef";
+  for (size_t i = 0; i < length; i++) {
+    Serial.write(digits[data[i] >> 4]);
+    Serial.write(digits[data[i] & 0x0F]);
+  }
+}
 
-#ifdef USE_TFT_ST7789
-  Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
-  #define DISPLAY_COLOR_WHITE ST77XX_WHITE
-  #define DISPLAY_COLOR_BLACK ST77XX_BLACK
-  #define DISPLAY_COLOR_GREEN ST77XX_GREEN
-  #define DISPLAY_COLOR_RED ST77XX_RED
-#endif
-#ifdef USE_OLED_GME128128
-U8G2_SH1107_SEEED_128X128_F_HW_I2C u8g2_oled(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
-  #define DISPLAY_COLOR_WHITE 1
-  #define DISPLAY_COLOR_BLACK 0
-  #define DISPLAY_COLOR_GREEN 1
-  #define DISPLAY_COLOR_RED 1
-#endif
+static void printTrace(const uint8_t* head, size_t headLength, const uint8_t* data, size_t length) {
+  Serial.print("TRACE ");
+  printTraceHex(head, headLength);
+  printTraceHex(data, length);
+  Serial.println();
+}
 
-extern const uint8_t u8g2_font_unifont_t_vietnamese2[15330] U8G2_FONT_SECTION("u8g2_font_unifont_t_vietnamese2");
-extern const uint8_t u8g2_font_inr33_mf[11616] U8G2_FONT_SECTION("u8g2_font_inr33_mf");
-extern const uint8_t u8g2_font_helvB18_tf[4956] U8G2_FONT_SECTION("u8g2_font_helvB18_tf");
-extern const uint8_t u8g2_font_unifont_t_vietnamese1[4308] U8G2_FONT_SECTION("u8g2_font_unifont_t_vietnamese1");
+static TraceWriter bleTrace(printTrace);
+#endif
 
-// BLE Variables (unchanged)
-static NimBLEServer* pServer;
-static NimBLECharacteristic* pCharacteristic;
-static bool deviceConnected = false;
-static bool lastConnectionStt = false;
-static bool displayNeedsUpdate = true;
-static String connectedDeviceAddress = "";
-
-// Scrolling state
-static bool isScrolling = false;
-static uint32_t scrollStartTime = 0;
-static int16_t scrollTextWidth = 0;
-
-// Data Buffer (unchanged)
-#define MAX_BUFFER_SIZE 60000
-uint8_t dataBuffer[MAX_BUFFER_SIZE];
-uint32_t dataIndex = 0;
-bool receivingData = false;
-
-// Parsed Data (unchanged)
-uint8_t* bitmapData = nullptr;
-uint32_t bitmapSize = 0;
-String title = "N/A";
-String eta = "N/A";
-String distance = "N/A";
-
-// Function Prototypes
-void processReceivedData(uint8_t* data, size_t length);
-void parseData();
-void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h);
-void updateDisplay();
-void drawUnicodeString(int16_t x, int16_t y, const char *text, uint16_t color, const uint8_t *font);
-void drawBitmapScaled(U8G2 &u8g2, int x, int y, const uint8_t *bitmap, int width, int height, int scale);
-
-// BLE Callbacks (unchanged)
+// BLE callbacks: they queue writes and leave marks, the tasks do the work
 class MyCharacteristicCallback : public NimBLECharacteristicCallbacks {
   void onWrite(NimBLECharacteristic* pCharacteristic) override {
     std::string value = pCharacteristic->getValue();
     if (value.length() > 0) {
-      processReceivedData((uint8_t*)value.data(), value.length());
+#ifdef ENABLE_BLE_TRACE
+      bleTrace.record(micros(), TRACE_WRITE, (const uint8_t*)value.data(), value.length());
+#endif
+      appQueueWrite((const uint8_t*)value.data(), value.length());
     }
   }
 };
 
+// Flow-controlled chunks (transfer_receiver.h); not traced
+class TransferCharacteristicCallback : public NimBLECharacteristicCallbacks {
+  void onWrite(NimBLECharacteristic* pCharacteristic) override {
+    std::string value = pCharacteristic->getValue();
+    appQueueTransfer((const uint8_t*)value.data(), value.length());
+  }
+};
+
 class MyServerCallbacks : public NimBLEServerCallbacks {
   void onConnect(NimBLEServer* pServer) override {
-    deviceConnected = true;
-    displayNeedsUpdate = true;
+#ifdef ENABLE_BLE_TRACE
+    bleTrace.record(micros(), TRACE_CONNECT);
+#endif
+    appSetConnected(true);
+  }
+
+  void onConnect(NimBLEServer* pServer, ble_gap_conn_desc* desc) override {
+    const uint8_t* a = desc->peer_ota_addr.val;
+    char address[18];
+    snprintf(address, sizeof(address), "%02x:%02x:%02x:%02x:%02x:%02x", a[5], a[4], a[3], a[2], a[1], a[0]);
+    connectedDeviceAddress = address;
+    connHandle = desc->conn_handle;
+    halLog("Device connected: %s\n", connectedDeviceAddress.c_str());
+  }
+
+  void onMTUChange(uint16_t MTU, ble_gap_conn_desc* desc) override {
+    appLinkChanged();
   }
 
   void onDisconnect(NimBLEServer* pServer) override {
-    deviceConnected = false;
-    displayNeedsUpdate = true;
-    connectedDeviceAddress = "";
+#ifdef ENABLE_BLE_TRACE
+    bleTrace.record(micros(), TRACE_DISCONNECT);
+#endif
+    appSetConnected(false);
+    connHandle = BLE_HS_CONN_HANDLE_NONE;
+    connectedDeviceAddress.clear();
     Serial.println("Device disconnected");
     NimBLEDevice::startAdvertising();
   }
 };
 
-// Process Received Data (unchanged)
-void processReceivedData(uint8_t* data, size_t length) {
-  for (size_t i = 0; i < length; i++) {
-    dataBuffer[dataIndex++] = data[i];
-    if (!receivingData && dataIndex >= 5) {
-      if (strncmp((char*)dataBuffer, ">>>>>", 5) == 0) {
-        receivingData = true;
-        memmove(dataBuffer, dataBuffer + 5, dataIndex - 5);
-        dataIndex -= 5;
-      }
-    }
-    if (receivingData && dataIndex >= 5) {
-      if (strncmp((char*)(dataBuffer + dataIndex - 5), "<<<<<", 5) == 0) {
-        receivingData = false;
-        dataIndex -= 5;
-        parseData();
-        dataIndex = 0;
-        displayNeedsUpdate = true;
-      }
-    }
-    if (dataIndex >= MAX_BUFFER_SIZE) {
-      dataIndex = 0;
-      receivingData = false;
-      Serial.println("Buffer overflow, resetting");
-    }
+class StatusCharacteristicCallback : public NimBLECharacteristicCallbacks {
+#ifdef ENABLE_PIPELINE_STATS
+  // Reads of the status characteristic always return fresh stats
+  void onRead(NimBLECharacteristic* pCharacteristic) override {
+    uint8_t buffer[STATS_FRAME_MAX];
+    size_t length = appStatsFrame(buffer, sizeof(buffer));
+    pCharacteristic->setValue(buffer, length);
   }
-}
+#endif
 
-// Parse Data (unchanged)
-void parseData() {
-  uint8_t* separator = (uint8_t*)memchr(dataBuffer, ';', dataIndex);
-  if (!separator) {
-    Serial.println("Invalid data: separator not found");
-    return;
+  // A new subscriber gets the current link status
+  void onSubscribe(NimBLECharacteristic* pCharacteristic, ble_gap_conn_desc* desc, uint16_t subValue) override {
+    if (subValue) appLinkChanged();
   }
-  bitmapSize = separator - dataBuffer;
-  bitmapData = dataBuffer;
-  uint32_t textStart = bitmapSize + 1;
-  uint32_t textLength = dataIndex - textStart;
-  String textData = String((char*)(dataBuffer + textStart), textLength);
-  int firstPipe = textData.indexOf('|');
-  int secondPipe = textData.indexOf('|', firstPipe + 1);
-  if (firstPipe != -1 && secondPipe != -1) {
-    title = textData.substring(0, firstPipe);
-    eta = textData.substring(firstPipe + 1, secondPipe);
-    distance = textData.substring(secondPipe + 1);
-  } else {
-    title = "N/A";
-    eta = "N/A";
-    distance = "N/A";
+};
+
+// Connection parameter and PHY updates are not passed on to the server
+// callbacks; this listener sees every GAP event
+static ble_gap_event_listener linkListener;
+
+static int onGapEvent(ble_gap_event* event, void*) {
+  if (event->type == BLE_GAP_EVENT_CONN_UPDATE) {
+    appLinkParamsUpdated(event->conn_update.status == 0);
+  } else if (event->type == BLE_GAP_EVENT_PHY_UPDATE_COMPLETE) {
+    appLinkPhyUpdated(event->phy_updated.status == 0 && event->phy_updated.tx_phy == BLE_GAP_LE_PHY_2M);
   }
+  return 0;
 }
 
-void drawBitmapScaled(U8G2 &u8g2, int x, int y, const uint8_t *bitmap, int width, int height, int scale) {
-  if (!bitmap || scale < 1) return;
+// HAL
+uint32_t halMillis() {
+  return millis();
+}
 
-  for (int row = 0; row < height; ++row) {
-    for (int col = 0; col < width; ++col) {
-      int byteIndex = row * ((width + 7) / 8) + (col / 8);
-      int bitMask = 0x80 >> (col % 8);
-      bool pixelOn = bitmap[byteIndex] & bitMask;
+uint32_t halMicros() {
+  return micros();
+}
 
-      if (pixelOn) {
-        u8g2.drawBox(x + col * scale, y + row * scale, scale, scale);
-      }
-    }
-  }
+void halLog(const char* format, ...) {
+  char line[128];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+  Serial.print(line);
 }
 
-void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h) {
-  if (!bitmap) {
-    Serial.println("Invalid bitmap: null pointer");
-    return;
-  }
+void halNotifyStatus(const uint8_t* data, size_t length) {
+  pStatusCharacteristic->setValue(data, length);
+  pStatusCharacteristic->notify();
+}
 
-#ifdef USE_TFT_ST7789
-  // TFT rendering (unchanged, 132x132)
-  for (int16_t j = 0; j < h; j++) {
-    int16_t startX = x;
-    int16_t lineStart = 0;
-    bool lastPixel = false;
-    for (int16_t i = 0; i < w; i++) {
-      int32_t pixelIndex = j * w + i;
-      int32_t byteIndex = pixelIndex / 8;
-      int32_t bitIndex = 7 - (pixelIndex % 8);
-      bool currentPixel = (bitmap[byteIndex] >> bitIndex) & 0x01;
-      if (currentPixel != lastPixel || i == w - 1) {
-        if (i == w - 1 && currentPixel == lastPixel) {
-          i++;
-        }
-        int16_t segmentWidth = i - lineStart;
-        if (segmentWidth > 0) {
-          uint16_t color = lastPixel ? DISPLAY_COLOR_WHITE : DISPLAY_COLOR_BLACK;
-          tft.drawFastHLine(startX, y + j, segmentWidth, color);
-        }
-        startX = x + i;
-        lineStart = i;
-        lastPixel = currentPixel;
-      }
-    }
-  }
-#endif
-#ifdef USE_OLED_GME128128
-u8g2_oled.setDrawColor(1); // Set color to white
-for (int16_t j = 0; j < h; j++) {
-  for (int16_t i = 0; i < w; i++) {
-    int32_t pixelIndex = j * w + i;
-    int32_t byteIndex = pixelIndex / 8;
-    int32_t bitIndex = 7 - (pixelIndex % 8);
-    bool pixelOn = (bitmap[byteIndex] >> bitIndex) & 0x01;
-    if (pixelOn) {
-      u8g2_oled.drawPixel(x + i, y + j);
-    }
-  }
+bool halStatusSubscribed() {
+  return pStatusCharacteristic->getSubscribedCount() > 0;
 }
-#endif
+
+void halNotifyTransfer(const uint8_t* data, size_t length) {
+  pTransferCharacteristic->setValue(data, length);
+  pTransferCharacteristic->notify();
 }
 
-void drawUnicodeString(int16_t x, int16_t y, const char *text, uint16_t color, const uint8_t *font) {
-#ifdef USE_TFT_ST7789
-  // Unchanged TFT code
-  u8g2.begin(tft);
-  u8g2.setFont(font);
-  u8g2.setForegroundColor(color);
-  u8g2.setFontMode(1);
-  const int16_t maxWidth = SCREEN_WIDTH - x;
-  const int16_t lineHeight = u8g2.getFontAscent() - u8g2.getFontDescent();
-  int16_t currentX = x;
-  int16_t currentY = y;
-  String currentLine = "";
-
-  const char *p = text;
-  while (*p) {
-    currentLine += *p;
-    int16_t textWidth = u8g2.getUTF8Width(currentLine.c_str());
-    if (textWidth > maxWidth && currentLine.length() > 1) {
-      int lastSpace = currentLine.lastIndexOf(' ');
-      if (lastSpace != -1) {
-        String lineToDraw = currentLine.substring(0, lastSpace);
-        u8g2.setCursor(currentX, currentY);
-        u8g2.print(lineToDraw.c_str());
-        currentLine = currentLine.substring(lastSpace + 1);
-      } else {
-        u8g2.setCursor(currentX, currentY);
-        u8g2.print(currentLine.c_str());
-        currentLine = "";
-      }
-      currentY += lineHeight + LINE_SPACING_OFFSET;
-    }
-    p++;
+// BLE link. These run on the render task; NimBLE's host API locks
+// internally.
+bool halLinkRequestPhy2M() {
+  if (connHandle == BLE_HS_CONN_HANDLE_NONE) return false;
+  // Fails on controllers without BLE 5 (classic ESP32); the link stays 1M
+  int rc = ble_gap_set_prefered_le_phy(connHandle, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_2M_MASK,
+                                       BLE_GAP_LE_PHY_CODED_ANY);
+  return rc == 0;
+}
+
+bool halLinkRequestParams(const LinkParams& params) {
+  if (connHandle == BLE_HS_CONN_HANDLE_NONE) return false;
+  ble_gap_upd_params update = {};
+  update.itvl_min = params.minInterval;
+  update.itvl_max = params.maxInterval;
+  update.latency = params.latency;
+  update.supervision_timeout = params.timeout;
+  return ble_gap_update_params(connHandle, &update) == 0;
+}
+
+void halLinkRead(LinkState& state) {
+  state = LinkState{};
+  uint16_t handle = connHandle;
+  ble_gap_conn_desc desc;
+  if (handle == BLE_HS_CONN_HANDLE_NONE || ble_gap_conn_find(handle, &desc) != 0) return;
+  state.mtu = pServer->getPeerMTU(handle);
+  state.interval = desc.conn_itvl;
+  state.latency = desc.conn_latency;
+  state.timeout = desc.supervision_timeout;
+  uint8_t tx, rx;
+  if (ble_gap_read_le_phy(handle, &tx, &rx) == 0) {
+    state.txPhy = tx;
+    state.rxPhy = rx;
   }
-  if (currentLine.length() > 0) {
-    u8g2.setCursor(currentX, currentY);
-    u8g2.print(currentLine.c_str());
+}
+
+// Tasks. The BLE callbacks only queue writes; the ingest task assembles and
+// parses them and the render task draws, each on its own core when there
+// are two (config.h).
+static TaskHandle_t ingestTaskHandle = nullptr;
+static TaskHandle_t renderTaskHandle = nullptr;
+
+// Single-core chips (ESP32-C3) only have core 0
+static BaseType_t taskCore(BaseType_t core) {
+  return portNUM_PROCESSORS > 1 ? core : 0;
+}
+
+void halIngestWake() {
+  if (ingestTaskHandle) xTaskNotifyGive(ingestTaskHandle);
+}
+
+void halRenderWake() {
+  if (renderTaskHandle) xTaskNotifyGive(renderTaskHandle);
+}
+
+static void ingestTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    appIngest();
   }
-#endif
-#ifdef USE_OLED_GME128128
-  u8g2_oled.setFont(font);
-  u8g2_oled.setDrawColor(color);
-  int16_t textWidth = u8g2_oled.getUTF8Width(text);
-  const int16_t maxWidth = SCREEN_WIDTH - x; // 126 at x=2
-
-  if (textWidth <= maxWidth) {
-    // Static text
-    u8g2_oled.drawUTF8(x, y, text);
-    isScrolling = false;
-  } else {
-    // Scrolling text
-    isScrolling = true;
-    scrollTextWidth = textWidth;
-    if (scrollStartTime == 0) {
-      scrollStartTime = millis();
-    }
-    // Scroll right to left, 5s cycle
-    uint32_t elapsed = millis() - scrollStartTime;
-    // Add 500ms pause at start
-    int16_t offset;
-    if (elapsed < 500) {
-      offset = 0; // Pause
-    } else {
-      uint32_t scrollTime = elapsed - 500;
-      offset = (scrollTime % 8000) * (textWidth + SCREEN_WIDTH) / 8000;
-    }
-    int16_t drawX = SCREEN_WIDTH - offset;
-    u8g2_oled.setClipWindow(x, y - u8g2_oled.getFontAscent() - 6, x + maxWidth, y + u8g2_oled.getFontDescent()+ 6);
-    u8g2_oled.drawUTF8(drawX, y, text);
-    u8g2_oled.setClipWindow(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT); // Reset clip
+}
+
+// Sleeps until the ingest side hands it a frame or the scheduler's next
+// deadline (a marquee frame, a stats notify) comes up
+static void renderTask(void*) {
+  for (;;) {
+    appLoop();
+    uint32_t wait = appNextWakeMs();
+    if (wait == 0) continue;
+    TickType_t ticks = wait == APP_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(wait);
+    ulTaskNotifyTake(pdTRUE, ticks ? ticks : 1);
   }
-#endif
 }
 
-void updateDisplay() {
-  int yOffset = 0;
+void halDisplayBegin() {
 #ifdef USE_TFT_ST7789
-  int xOffset = (SCREEN_WIDTH - BITMAP_WIDTH) / 2;
+  tft.init(240, 320);
+  tft.setSPISpeed(80000000);
+  tft.setRotation(0);
+  tft.fillScreen(ST77XX_BLACK);
 #endif
 #ifdef USE_OLED_GME128128
-  int xOffset = 2; // Bitmap on left
+  u8g2_oled.begin();
   u8g2_oled.clearBuffer();
+  u8g2_oled.setPowerSave(0);
 #endif
+}
 
-  if (deviceConnected) {
-    yOffset = 0;
-    // Status bar
-#ifdef USE_TFT_ST7789
-    tft.fillRect(0, 0, SCREEN_WIDTH, STATUS_BAR_HEIGHT, deviceConnected ? DISPLAY_COLOR_GREEN : DISPLAY_COLOR_RED);
-    drawUnicodeString(5, 20, deviceConnected ? "Connected" : "Disconnected", DISPLAY_COLOR_BLACK, u8g2_font_unifont_t_vietnamese2);
-#endif
-
-    // Navigation data
-    yOffset += 2; // y=18
-#ifdef USE_TFT_ST7789
-    drawBitmap(xOffset, yOffset, bitmapData, 132, 132);
-    yOffset = 200;
-    tft.fillRect(0, BITMAP_HEIGHT + STATUS_BAR_HEIGHT - 10, SCREEN_WIDTH, SCREEN_HEIGHT - yOffset, DISPLAY_COLOR_BLACK);
-    drawUnicodeString(xOffset, yOffset, distance.c_str(), DISPLAY_COLOR_GREEN, u8g2_font_inr33_mf);
-    yOffset += 40;
-    tft.fillRect(0, yOffset, SCREEN_WIDTH, SCREEN_HEIGHT, DISPLAY_COLOR_BLACK);
-    drawUnicodeString(5, yOffset, title.c_str(), DISPLAY_COLOR_WHITE, myfont);
-    yOffset = 304;
-    drawUnicodeString(5, yOffset, eta.c_str(), DISPLAY_COLOR_WHITE, myfont);
-#endif
 #ifdef USE_OLED_GME128128
-    drawBitmap(xOffset, yOffset, bitmapData, BITMAP_WIDTH, BITMAP_HEIGHT);
-    // ETA bound (right side of bitmap)
-    int etaX = 20; // x=74
-    int etaWidth = SCREEN_WIDTH - etaX - 2; // 52
-    int etaHeight = BITMAP_HEIGHT; // 70
-    // u8g2_oled.drawFrame(etaX, yOffset, etaWidth, etaHeight);
-    // Center ETA text
-    u8g2_oled.setFont(u8g2_font_helvB18_tf);
-    int textWidth = u8g2_oled.getUTF8Width(eta.c_str());
-    int textX = etaX + (etaWidth - textWidth) / 2;
-    int textY = yOffset + BITMAP_WIDTH + 10;
-    drawUnicodeString(textX, textY, distance.c_str(), DISPLAY_COLOR_WHITE, u8g2_font_helvB18_tf);
-    // Direction at bottom (with wrapping downward)
-    drawUnicodeString(0, 124, title.c_str(), DISPLAY_COLOR_WHITE, u8g2_font_unifont_t_vietnamese1);
+u8g2_t* halOled() {
+  return u8g2_oled.getU8g2();
+}
 #endif
-    lastConnectionStt = deviceConnected;
-  } else {
+
 #ifdef USE_TFT_ST7789
-    tft.fillScreen(DISPLAY_COLOR_BLACK);
-    tft.fillRect(0, 0, SCREEN_WIDTH, STATUS_BAR_HEIGHT, deviceConnected ? DISPLAY_COLOR_GREEN : DISPLAY_COLOR_RED);
-    drawUnicodeString(5, 20, deviceConnected ? "Connected" : "Disconnected", DISPLAY_COLOR_WHITE, u8g2_font_unifont_t_vietnamese2);
-    drawBitmap(54, 70, disconnected_icon_9, BITMAP_WIDTH, BITMAP_HEIGHT);
-#endif
-#ifdef USE_OLED_GME128128
-    u8g2_oled.drawBox(0, 0, SCREEN_WIDTH, STATUS_BAR_HEIGHT);
-    drawUnicodeString(5, 14, deviceConnected ? "Connected" : "Disconnected", DISPLAY_COLOR_BLACK, u8g2_font_helvB12_tf);
-    drawBitmap(19, 39, disconnected_icon_90, BITMAP_WIDTH, BITMAP_HEIGHT);
-#endif
-  }
+void halTftFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  tft.fillRect(x, y, w, h, color);
+}
 
-#ifdef USE_OLED_GME128128
-  u8g2_oled.sendBuffer();
-#endif
+void halTftBeginWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+}
+
+void halTftPushPixels(const uint16_t* pixels, uint32_t count) {
+  tft.writePixels((uint16_t*)pixels, count, true);
 }
 
+void halTftEndWindow() {
+  tft.endWrite();
+}
+#endif
+
 void setup() {
   Serial.begin(115200);
 
-  // Initialize Display
-#ifdef USE_TFT_ST7789
-  tft.init(240, 320);
-  tft.setSPISpeed(80000000);
-  tft.setRotation(0);
-  tft.fillScreen(DISPLAY_COLOR_BLACK);
-#endif
-#ifdef USE_OLED_GME128128
-  u8g2_oled.begin();
-  u8g2_oled.clearBuffer();
-  u8g2_oled.setPowerSave(0);
-#endif
+  // Display and icon cache first, then the tasks that use them
+  appSetup();
+  xTaskCreatePinnedToCore(ingestTask, "ingest", INGEST_TASK_STACK, nullptr, INGEST_TASK_PRIORITY,
+                          &ingestTaskHandle, taskCore(INGEST_TASK_CORE));
+  xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, nullptr, RENDER_TASK_PRIORITY,
+                          &renderTaskHandle, taskCore(RENDER_TASK_CORE));
 
-  // BLE Setup (unchanged)
+  // BLE last, so nothing is written before the tasks run
   NimBLEDevice::init("WeNav_OLED_ESP32C3");
+  NimBLEDevice::setMTU(LINK_MTU);  // offered when the phone starts the MTU exchange
+  ble_gap_event_listener_register(&linkListener, onGapEvent, nullptr);
   pServer = NimBLEDevice::createServer();
   pServer->setCallbacks(new MyServerCallbacks());
   NimBLEService* pService = pServer->createService(NimBLEUUID("18199909-f923-426c-9fdd-1e7a884d8aa2"));
@@ -381,32 +298,30 @@ void setup() {
       NIMBLE_PROPERTY::WRITE | NIMBLE_PROPERTY::WRITE_NR
   );
   pCharacteristic->setCallbacks(new MyCharacteristicCallback());
+  pStatusCharacteristic = pService->createCharacteristic(
+      NimBLEUUID("a37b8b6e-00e9-41db-ad37-9808464cba1b"),
+      NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::NOTIFY
+  );
+  pStatusCharacteristic->setCallbacks(new StatusCharacteristicCallback());
+  pTransferCharacteristic = pService->createCharacteristic(
+      NimBLEUUID("a37b8b6f-00e9-41db-ad37-9808464cba1b"),
+      NIMBLE_PROPERTY::WRITE_NR | NIMBLE_PROPERTY::NOTIFY
+  );
+  pTransferCharacteristic->setCallbacks(new TransferCharacteristicCallback());
   pService->start();
   NimBLEAdvertising* pAdvertising = NimBLEDevice::getAdvertising();
   pAdvertising->addServiceUUID(NimBLEUUID("18199909-f923-426c-9fdd-1e7a884d8aa2"));
   pAdvertising->start();
 
   Serial.println("BLE Server started");
-  updateDisplay();
-#ifdef USE_TFT_ST7789
-  drawBitmap(54, 70, disconnected_icon_9, BITMAP_WIDTH, BITMAP_HEIGHT);
-#endif
-#ifdef USE_OLED_GME128128
-  drawBitmap(29, 29, disconnected_icon_9, BITMAP_WIDTH, BITMAP_HEIGHT);
-  u8g2_oled.sendBuffer();
-#endif
 }
 
 void loop() {
-  static uint32_t lastUpdate = 0;
-  uint32_t now = millis();
-  if (isScrolling && (now - lastUpdate >= 100)) { // Update every 100ms
-    displayNeedsUpdate = true;
-    lastUpdate = now;
-  }
-  if (displayNeedsUpdate) {
-    updateDisplay();
-    displayNeedsUpdate = false;
+  // Rendering happens in renderTask; this only serves the Serial console
+  if (Serial.available()) {
+    int c = Serial.read();
+    if (c == 's') appDumpStats();
+    if (c == 'r') appResetStats();
   }
-  delay(10);
-}
\ No newline at end of file
+  delay(100);
+}
@@ -0,0 +1,242 @@
+#include "hal.h"
+#include "app.h"
+#include "native.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+// Two clocks: halMillis() is simulated and only moves when the runner
+// advances it, so animations replay the same way every run; halMicros() is
+// real time, for profiling.
+static uint64_t simulatedUs = 0;
+
+void nativeAdvanceClock(uint64_t us) {
+  simulatedUs += us;
+}
+
+uint32_t halMillis() {
+  return simulatedUs / 1000;
+}
+
+uint32_t halMicros() {
+  static const auto start = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void halLog(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+}
+
+// Wake-ups are picked up by the runner between BLE events
+static bool ingestWake = false;
+static bool renderWake = false;
+
+void halIngestWake() {
+  ingestWake = true;
+}
+
+bool nativeTakeIngestWake() {
+  bool wake = ingestWake;
+  ingestWake = false;
+  return wake;
+}
+
+void halRenderWake() {
+  renderWake = true;
+}
+
+bool nativeTakeRenderWake() {
+  bool wake = renderWake;
+  renderWake = false;
+  return wake;
+}
+
+// Status characteristic
+static bool statusSubscribed = false;
+
+void nativeSubscribeStatus(bool subscribed) {
+  statusSubscribed = subscribed;
+}
+
+void halNotifyStatus(const uint8_t* data, size_t length) {
+  printf("notify:");
+  for (size_t i = 0; i < length; i++) printf(" %02x", data[i]);
+  printf("\n");
+}
+
+bool halStatusSubscribed() {
+  return statusSubscribed;
+}
+
+// Transfer characteristic: ACKs wait here for the simulated sender
+static std::vector<std::vector<uint8_t>> transferAcks;
+
+void halNotifyTransfer(const uint8_t* data, size_t length) {
+  transferAcks.emplace_back(data, data + length);
+}
+
+void nativeTakeTransferAcks(std::vector<std::vector<uint8_t>>& acks) {
+  acks.swap(transferAcks);
+  transferAcks.clear();
+}
+
+// BLE link: stands in for the peer behind the NimBLE calls. A connection
+// starts where a phone leaves it (23 byte MTU, 1M PHY, 30 ms interval);
+// granted parameter requests settle on the longest interval offered, as
+// phones tend to. Outcomes are reported right away.
+static LinkState link;
+static NativePeer peer = NATIVE_PEER_ACCEPT;
+
+void nativeLinkConnect() {
+  link = LinkState{23, 1, 1, 24, 0, 500};
+  peer = NATIVE_PEER_ACCEPT;
+}
+
+void nativeSetMtu(uint16_t mtu) {
+  link.mtu = mtu < LINK_MTU ? mtu : LINK_MTU;
+  appLinkChanged();
+}
+
+void nativeSetPeer(NativePeer mode) {
+  peer = mode;
+}
+
+bool halLinkRequestPhy2M() {
+  printf("link request: 2M PHY\n");
+  if (peer == NATIVE_PEER_BUSY) return false;
+  if (peer == NATIVE_PEER_ACCEPT) link.txPhy = link.rxPhy = 2;
+  appLinkPhyUpdated(link.txPhy == 2);
+  return true;
+}
+
+bool halLinkRequestParams(const LinkParams& params) {
+  printf("link request: interval %u-%u, latency %u, timeout %u\n", (unsigned)params.minInterval,
+         (unsigned)params.maxInterval, (unsigned)params.latency, (unsigned)params.timeout);
+  if (peer == NATIVE_PEER_BUSY) return false;
+  if (peer == NATIVE_PEER_ACCEPT) {
+    link.interval = params.maxInterval;
+    link.latency = params.latency;
+    link.timeout = params.timeout;
+  }
+  appLinkParamsUpdated(peer == NATIVE_PEER_ACCEPT);
+  return true;
+}
+
+void halLinkRead(LinkState& state) {
+  state = link;
+}
+
+#ifdef USE_OLED_GME128128
+// The u8g2 core draws into its own buffer as on the device; tiles it sends
+// to the display land in `panel`, so partial flushes show up as they would
+// on the SH1107.
+static u8g2_t oled;
+static u8x8_display_info_t oledInfo;
+static uint8_t oledBuffer[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+static uint8_t panel[SCREEN_WIDTH * SCREEN_HEIGHT / 8];
+
+static uint8_t nativeOledDisplay(u8x8_t* u8x8, uint8_t msg, uint8_t arg_int, void* arg_ptr) {
+  if (msg == U8X8_MSG_DISPLAY_SETUP_MEMORY) {
+    u8x8_d_helper_display_setup_memory(u8x8, &oledInfo);
+  } else if (msg == U8X8_MSG_DISPLAY_DRAW_TILE) {
+    u8x8_tile_t* tile = (u8x8_tile_t*)arg_ptr;
+    uint16_t x = tile->x_pos * 8;
+    for (uint8_t repeat = 0; repeat < arg_int; repeat++) {
+      for (uint16_t i = 0; i < tile->cnt * 8 && x < SCREEN_WIDTH; i++, x++) {
+        panel[tile->y_pos * SCREEN_WIDTH + x] = tile->tile_ptr[i];
+      }
+    }
+  }
+  return 1;
+}
+
+void halDisplayBegin() {
+  memset(&oledInfo, 0, sizeof(oledInfo));
+  oledInfo.tile_width = SCREEN_WIDTH / 8;
+  oledInfo.tile_height = SCREEN_HEIGHT / 8;
+  oledInfo.pixel_width = SCREEN_WIDTH;
+  oledInfo.pixel_height = SCREEN_HEIGHT;
+  u8x8_Setup(u8g2_GetU8x8(&oled), nativeOledDisplay, u8x8_cad_empty, u8x8_byte_empty, u8x8_dummy_cb);
+  u8g2_SetupBuffer(&oled, oledBuffer, SCREEN_HEIGHT / 8, u8g2_ll_hvline_vertical_top_lsb, U8G2_R0);
+  u8g2_InitDisplay(&oled);
+  u8g2_ClearBuffer(&oled);
+  u8g2_SendBuffer(&oled);
+  u8g2_SetPowerSave(&oled, 0);
+}
+
+u8g2_t* halOled() {
+  return &oled;
+}
+
+bool nativeDumpDisplay(const char* path) {
+  FILE* file = fopen(path, "wb");
+  if (!file) return false;
+  fprintf(file, "P4\n%d %d\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    uint8_t row[SCREEN_WIDTH / 8] = {0};
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+      if (panel[(y / 8) * SCREEN_WIDTH + x] & (1 << (y & 7))) row[x / 8] |= 0x80 >> (x & 7);
+    }
+    fwrite(row, 1, sizeof(row), file);
+  }
+  fclose(file);
+  return true;
+}
+#endif
+
+#ifdef USE_TFT_ST7789
+static uint16_t panel[SCREEN_WIDTH * SCREEN_HEIGHT];
+static int16_t windowX, windowY, windowW, windowH;
+static uint32_t windowPos;
+
+void halDisplayBegin() {
+  memset(panel, 0, sizeof(panel));
+}
+
+void halTftFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t j = y < 0 ? 0 : y; j < y + h && j < SCREEN_HEIGHT; j++) {
+    for (int16_t i = x < 0 ? 0 : x; i < x + w && i < SCREEN_WIDTH; i++) {
+      panel[j * SCREEN_WIDTH + i] = color;
+    }
+  }
+}
+
+void halTftBeginWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+  windowX = x;
+  windowY = y;
+  windowW = w;
+  windowH = h;
+  windowPos = 0;
+}
+
+void halTftPushPixels(const uint16_t* pixels, uint32_t count) {
+  for (uint32_t i = 0; i < count; i++, windowPos++) {
+    int16_t x = windowX + windowPos % windowW;
+    int16_t y = windowY + (windowPos / windowW) % windowH;
+    if (x >= 0 && x < SCREEN_WIDTH && y >= 0 && y < SCREEN_HEIGHT) panel[y * SCREEN_WIDTH + x] = pixels[i];
+  }
+}
+
+void halTftEndWindow() {
+}
+
+bool nativeDumpDisplay(const char* path) {
+  FILE* file = fopen(path, "wb");
+  if (!file) return false;
+  fprintf(file, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+  for (uint32_t i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+    uint16_t c = panel[i];
+    uint8_t rgb[3] = {(uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3)};
+    fwrite(rgb, 1, sizeof(rgb), file);
+  }
+  fclose(file);
+  return true;
+}
+#endif
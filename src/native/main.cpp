@@ -0,0 +1,409 @@
+// Host entry point (env:native): plays a BLE script against the app logic.
+//
+//   program <script>
+//
+// One command per line; lines starting with '#' are comments:
+//   connect | disconnect      connection events
+//   mtu <n>                   the peer settles on an MTU of n
+//   peer accept|refuse|busy   how the peer answers link requests: grants
+//                             them, rejects them, or the stack is busy
+//   subscribe | unsubscribe   status characteristic notifications
+//   write <hex>               one BLE write, e.g. "write aa 01 01 ..."
+//   text <string>             one BLE write of the rest of the line
+//   send <file> [mtu]         a file split into writes of mtu bytes (244)
+//   transfer <file> [mtu] [loss%]
+//                             the same through the flow-controlled transfer
+//                             characteristic, over a link that loses loss%
+//                             of the chunks and ACKs (0)
+//   wait <ms>                 let ms of simulated time pass
+//   dump <file>               save the panel as PBM/PPM
+//   stats                     print the pipeline stats
+//   replay <file> [realtime]  play back a trace recorded with ENABLE_BLE_TRACE,
+//                             as fast as possible or at the recorded pace
+//   snapshots <prefix>        from now on, dump <prefix>NNNN after every
+//                             rendered frame ("snapshots" alone stops)
+
+// `pio test` links the tests in test/ against the rest of the host build;
+// they bring their own main()
+#ifndef PIO_UNIT_TESTING
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "app.h"
+#include "hal.h"
+#include "native.h"
+#include "trace.h"
+#include "transfer_receiver.h"
+
+#define DEFAULT_MTU    244
+
+// Simulated link for `transfer`: write-without-response packets per
+// connection event, events without an ACK before the sender resends its
+// oldest chunk, and when to give up
+#define SIM_WRITES_PER_EVENT  6
+#define SIM_RTO_EVENTS        4
+#define SIM_MAX_EVENTS        100000
+
+static std::string snapshotPrefix;
+static uint32_t snapshotCount = 0;
+static uint32_t framesRendered = 0;
+
+static void loopOnce() {
+  if (!appLoop()) return;
+  framesRendered++;
+  if (snapshotPrefix.empty()) return;
+  char path[4096];
+#ifdef USE_TFT_ST7789
+  snprintf(path, sizeof(path), "%s%04u.ppm", snapshotPrefix.c_str(), (unsigned)snapshotCount++);
+#else
+  snprintf(path, sizeof(path), "%s%04u.pbm", snapshotPrefix.c_str(), (unsigned)snapshotCount++);
+#endif
+  if (!nativeDumpDisplay(path)) perror(path);
+}
+
+// Plays `us` of simulated time the way the render task spends it on the
+// device: a loop right away if the app woke it, then one at each deadline
+// appNextWakeMs() asks for. Realtime also sleeps through it.
+static void runFor(uint64_t us, bool realtime = false) {
+  if (nativeTakeRenderWake()) loopOnce();
+  for (;;) {
+    uint32_t waitMs = appNextWakeMs();
+    if (waitMs == 0) {
+      loopOnce();
+      continue;
+    }
+    uint64_t step = waitMs == APP_WAIT_FOREVER ? us : std::min<uint64_t>(waitMs * 1000ull, us);
+    if (step == 0) return;
+    if (realtime) std::this_thread::sleep_for(std::chrono::microseconds(step));
+    nativeAdvanceClock(step);
+    us -= step;
+    if (step == waitMs * 1000ull) loopOnce();
+  }
+}
+
+// One BLE write, through the queue as on the device. The ingest task
+// outranks the render task, so it parses the write before anything else runs.
+static void bleWrite(const uint8_t* data, size_t length) {
+  appQueueWrite(data, length);
+  if (nativeTakeIngestWake()) appIngest();
+}
+
+// Transfer sender state that outlives one `transfer`: the sequence number
+// runs on for the whole connection, and the credit is the last one heard
+static uint16_t transferSeq = 0;
+static unsigned transferCredit = 1;
+
+static void bleConnect(bool connected) {
+  if (connected) {
+    nativeLinkConnect();
+    transferSeq = 0;
+    transferCredit = 1;
+  }
+  appSetConnected(connected);
+}
+
+static bool parseHex(const char* text, std::vector<uint8_t>& out) {
+  int high = -1;
+  for (const char* p = text; *p; p++) {
+    if (isspace((unsigned char)*p)) continue;
+    if (!isxdigit((unsigned char)*p)) return false;
+    int nibble = isdigit((unsigned char)*p) ? *p - '0' : tolower((unsigned char)*p) - 'a' + 10;
+    if (high < 0) {
+      high = nibble;
+    } else {
+      out.push_back((uint8_t)(high << 4 | nibble));
+      high = -1;
+    }
+  }
+  return high < 0;
+}
+
+static bool sendFile(const char* path, size_t mtu) {
+  FILE* file = fopen(path, "rb");
+  if (!file) return false;
+  std::vector<uint8_t> chunk(mtu);
+  size_t n;
+  while ((n = fread(chunk.data(), 1, mtu, file)) > 0) {
+    bleWrite(chunk.data(), n);
+  }
+  fclose(file);
+  return true;
+}
+
+static bool readFile(const char* path, std::vector<uint8_t>& out) {
+  FILE* file = fopen(path, "rb");
+  if (!file) return false;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) out.insert(out.end(), chunk, chunk + n);
+  fclose(file);
+  return true;
+}
+
+// The sender side of the transfer characteristic, as the phone should run
+// it: at most the credit past the cumulative ACK in flight, the holes the
+// selective ACK shows sent again first, and after SIM_RTO_EVENTS quiet
+// events the oldest chunk again with an ACK request. Each chunk and each
+// ACK is lost with probability lossPercent; the random sequence is the same
+// every run.
+static bool transferFile(const char* path, size_t mtu, unsigned lossPercent) {
+  std::vector<uint8_t> data;
+  if (!readFile(path, data)) return false;
+  size_t payload = std::min<size_t>(mtu, INGEST_WRITE_MAX);
+  if (payload <= TRANSFER_HEADER_LEN) return false;
+  payload -= TRANSFER_HEADER_LEN;
+  size_t count = (data.size() + payload - 1) / payload;
+
+  std::vector<bool> acked(count), resend(count);
+  std::vector<std::vector<uint8_t>> acks;
+  nativeTakeTransferAcks(acks);  // nobody was listening for these
+  uint32_t random = 1;
+  auto lose = [&]() {
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    return random % 100 < lossPercent;
+  };
+  unsigned sent = 0, again = 0, lost = 0, acksHeard = 0, acksLost = 0;
+  auto send = [&](size_t i, bool ackRequest) {
+    uint8_t chunk[INGEST_WRITE_MAX];
+    uint16_t word = ((transferSeq + i) & TRANSFER_SEQ_MASK) | (ackRequest ? TRANSFER_FLAG_ACK : 0);
+    size_t length = std::min(payload, data.size() - i * payload);
+    chunk[0] = (uint8_t)word;
+    chunk[1] = (uint8_t)(word >> 8);
+    memcpy(chunk + TRANSFER_HEADER_LEN, &data[i * payload], length);
+    sent++;
+    if (lose()) {
+      lost++;
+      return;
+    }
+    appQueueTransfer(chunk, TRANSFER_HEADER_LEN + length);
+    if (nativeTakeIngestWake()) appIngest();
+  };
+
+  uint64_t intervalUs = LINK_FAST_MAX_INTERVAL * 1250ull;
+  uint32_t framesBefore = framesRendered;
+  size_t base = 0, nextNew = 0;
+  unsigned events = 0, quiet = 0;
+  while (base < count) {
+    if (events++ == SIM_MAX_EVENTS) {
+      fprintf(stderr, "transfer %s: stalled at chunk %zu of %zu\n", path, base, count);
+      return false;
+    }
+    unsigned budget = SIM_WRITES_PER_EVENT;
+    for (size_t i = base; i < nextNew && budget; i++) {
+      if (!resend[i]) continue;
+      resend[i] = false;
+      send(i, false);
+      again++;
+      budget--;
+    }
+    while (budget && nextNew < count && nextNew < base + transferCredit) {
+      size_t i = nextNew++;
+      // Nothing follows for a while: ask for the ACK instead of waiting
+      send(i, nextNew == count || nextNew == base + transferCredit);
+      budget--;
+    }
+    if (quiet >= SIM_RTO_EVENTS && budget) {
+      send(base, true);
+      again++;
+      quiet = 0;
+    }
+    runFor(intervalUs);
+
+    nativeTakeTransferAcks(acks);
+    bool advanced = false;
+    for (const std::vector<uint8_t>& ack : acks) {
+      if (lose()) {
+        acksLost++;
+        continue;
+      }
+      acksHeard++;
+      if (ack.size() != TRANSFER_ACK_LEN) continue;
+      uint16_t next = ack[0] | (ack[1] << 8);
+      uint16_t sack = ack[2] | (ack[3] << 8);
+      size_t cumulative = base + ((next - transferSeq - base) & TRANSFER_SEQ_MASK);
+      if (cumulative > nextNew) continue;  // older than one already heard
+      transferCredit = ack[4];
+      if (cumulative > base) advanced = true;
+      for (; base < cumulative; base++) acked[base] = true;
+      size_t highest = base;
+      for (unsigned bit = 0; bit < 16; bit++) {
+        size_t i = base + 1 + bit;
+        if (!(sack >> bit & 1) || i >= count) continue;
+        acked[i] = true;
+        highest = i;
+      }
+      for (size_t i = base; i < highest; i++) {
+        if (!acked[i]) resend[i] = true;
+      }
+    }
+    quiet = advanced ? 0 : quiet + 1;
+  }
+  transferSeq = (transferSeq + count) & TRANSFER_SEQ_MASK;
+
+  printf("transfer %s: %zu bytes in %zu chunks, %u sent (%u again, %u lost), %u acks (%u lost), "
+         "%u events, %.0f ms, %.0f%% of link capacity, %u frames rendered\n",
+         path, data.size(), count, sent, again, lost, acksHeard, acksLost, events, events * intervalUs / 1000.0,
+         100.0 * count / (events * SIM_WRITES_PER_EVENT), (unsigned)(framesRendered - framesBefore));
+  return true;
+}
+
+// Feeds each record through the same entry points as the BLE callbacks,
+// with the render task scheduled in between as on the device, so frames
+// are coalesced the same way.
+static bool replayTrace(const char* path, bool realtime) {
+  std::vector<uint8_t> trace;
+  if (!readFile(path, trace)) return false;
+  TraceReader reader(trace.data(), trace.size());
+  if (!reader.valid()) {
+    fprintf(stderr, "%s: not a trace\n", path);
+    return false;
+  }
+
+  auto wallStart = std::chrono::steady_clock::now();
+  uint32_t framesBefore = framesRendered;
+  uint64_t traceUs = 0;
+  size_t records = 0, writes = 0, bytes = 0;
+  TraceRecord record;
+  while (reader.next(record)) {
+    runFor(record.deltaUs, realtime);
+    traceUs += record.deltaUs;
+    records++;
+    if (record.event == TRACE_WRITE) {
+      bleWrite(record.data, record.length);
+      writes++;
+      bytes += record.length;
+    } else {
+      bleConnect(record.event == TRACE_CONNECT);
+    }
+  }
+  runFor(0);
+
+  double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wallStart).count();
+  printf("replay %s: %zu records, %zu writes, %zu bytes, %u frames rendered, %.1f ms traced, %.1f ms wall\n",
+         path, records, writes, bytes, (unsigned)(framesRendered - framesBefore), traceUs / 1000.0, wallMs);
+  return true;
+}
+
+static bool runCommand(char* line) {
+  char* arg = line;
+  while (*arg && !isspace((unsigned char)*arg)) arg++;
+  if (*arg) *arg++ = '\0';
+  while (isspace((unsigned char)*arg)) arg++;
+
+  if (strcmp(line, "connect") == 0) {
+    bleConnect(true);
+  } else if (strcmp(line, "disconnect") == 0) {
+    bleConnect(false);
+  } else if (strcmp(line, "mtu") == 0) {
+    unsigned long mtu = strtoul(arg, nullptr, 10);
+    if (mtu < 23) return false;
+    nativeSetMtu(mtu);
+  } else if (strcmp(line, "peer") == 0) {
+    if (strcmp(arg, "accept") == 0) {
+      nativeSetPeer(NATIVE_PEER_ACCEPT);
+    } else if (strcmp(arg, "refuse") == 0) {
+      nativeSetPeer(NATIVE_PEER_REFUSE);
+    } else if (strcmp(arg, "busy") == 0) {
+      nativeSetPeer(NATIVE_PEER_BUSY);
+    } else {
+      return false;
+    }
+  } else if (strcmp(line, "subscribe") == 0) {
+    nativeSubscribeStatus(true);
+    appLinkChanged();
+  } else if (strcmp(line, "unsubscribe") == 0) {
+    nativeSubscribeStatus(false);
+  } else if (strcmp(line, "write") == 0) {
+    std::vector<uint8_t> data;
+    if (!parseHex(arg, data)) return false;
+    bleWrite(data.data(), data.size());
+  } else if (strcmp(line, "text") == 0) {
+    bleWrite((const uint8_t*)arg, strlen(arg));
+  } else if (strcmp(line, "send") == 0) {
+    char* mtuArg = strchr(arg, ' ');
+    size_t mtu = DEFAULT_MTU;
+    if (mtuArg) {
+      *mtuArg++ = '\0';
+      mtu = strtoul(mtuArg, nullptr, 10);
+      if (mtu == 0) return false;
+    }
+    return sendFile(arg, mtu);
+  } else if (strcmp(line, "transfer") == 0) {
+    char* options = strchr(arg, ' ');
+    size_t mtu = DEFAULT_MTU;
+    unsigned long loss = 0;
+    if (options) {
+      *options++ = '\0';
+      char* end;
+      mtu = strtoul(options, &end, 10);
+      if (mtu == 0) return false;
+      if (*end) loss = strtoul(end, nullptr, 10);
+      if (loss >= 100) return false;
+    }
+    return transferFile(arg, mtu, loss);
+  } else if (strcmp(line, "wait") == 0) {
+    runFor(strtoul(arg, nullptr, 10) * 1000ull);
+  } else if (strcmp(line, "dump") == 0) {
+    return nativeDumpDisplay(arg);
+  } else if (strcmp(line, "replay") == 0) {
+    char* mode = strchr(arg, ' ');
+    bool realtime = false;
+    if (mode) {
+      *mode++ = '\0';
+      if (strcmp(mode, "realtime") != 0) return false;
+      realtime = true;
+    }
+    return replayTrace(arg, realtime);
+  } else if (strcmp(line, "snapshots") == 0) {
+    snapshotPrefix = arg;
+    snapshotCount = 0;
+  } else if (strcmp(line, "stats") == 0) {
+    appDumpStats();
+  } else {
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <script>\n", argv[0]);
+    return 2;
+  }
+  FILE* script = fopen(argv[1], "r");
+  if (!script) {
+    perror(argv[1]);
+    return 2;
+  }
+
+  appSetup();
+  char line[4096];
+  int lineNumber = 0;
+  while (fgets(line, sizeof(line), script)) {
+    lineNumber++;
+    size_t length = strlen(line);
+    while (length && isspace((unsigned char)line[length - 1])) line[--length] = '\0';
+    char* command = line;
+    while (isspace((unsigned char)*command)) command++;
+    if (!*command || *command == '#') continue;
+    if (!runCommand(command)) {
+      fprintf(stderr, "%s:%d: bad command\n", argv[1], lineNumber);
+      fclose(script);
+      return 1;
+    }
+    runFor(0);  // the render task picks up what the command woke it for
+  }
+  fclose(script);
+  return 0;
+}
+
+#endif  // PIO_UNIT_TESTING
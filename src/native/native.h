@@ -0,0 +1,26 @@
+#ifndef NATIVE_H
+#define NATIVE_H
+
+#include <stdint.h>
+#include <vector>
+
+// Host-only controls over the simulated hardware in hal_native.cpp
+
+// Moves the simulated halMillis() clock forward
+void nativeAdvanceClock(uint64_t us);
+void nativeSubscribeStatus(bool subscribed);
+// Moves the transfer ACKs notified since the last call into `acks`
+void nativeTakeTransferAcks(std::vector<std::vector<uint8_t>>& acks);
+// True once after halIngestWake() / halRenderWake() was called
+bool nativeTakeIngestWake();
+bool nativeTakeRenderWake();
+// BLE link stand-in: a new connection at the defaults, the MTU the peer
+// settled on, and how the peer answers link requests
+enum NativePeer { NATIVE_PEER_ACCEPT, NATIVE_PEER_REFUSE, NATIVE_PEER_BUSY };
+void nativeLinkConnect();
+void nativeSetMtu(uint16_t mtu);
+void nativeSetPeer(NativePeer mode);
+// Writes what the panel shows as PBM (OLED) or PPM (TFT)
+bool nativeDumpDisplay(const char* path);
+
+#endif
@@ -0,0 +1,461 @@
+#include "nav_decoder.h"
+
+#include <string.h>
+#include "icon_cache.h"
+
+// The '<' of an end marker cut short, which turn out to be text
+static const uint8_t markerRun[FRAME_MARKER_LEN - 1] = {'<', '<', '<', '<'};
+
+static size_t deltaTileBytes(size_t tile) {
+  size_t start = tile * NAV_DELTA_TILE_BYTES;
+  return BITMAP_BYTES - start < NAV_DELTA_TILE_BYTES ? BITMAP_BYTES - start : NAV_DELTA_TILE_BYTES;
+}
+
+NavDecoder::NavDecoder(IconCache* icons) : icons_(icons), packBits_(nullptr, 0) {
+  reset();
+}
+
+void NavDecoder::reset() {
+  nav_ = nullptr;
+  state_ = STATE_HUNT;
+  startRun_ = 0;
+  endRun_ = 0;
+  partLen_ = 0;
+}
+
+void NavDecoder::push(const uint8_t* data, size_t length, NavDecodeSink& sink) {
+  while (length > 0) {
+    size_t used;
+    switch (state_) {
+      case STATE_HUNT:
+        used = hunt(data, length, sink);
+        break;
+      case STATE_HEADER:
+        used = header(data, length, sink);
+        break;
+      case STATE_FIELD_HEADER:
+        used = fieldHeader(data, length);
+        break;
+      case STATE_FIELD:
+        used = field(data, length);
+        break;
+      case STATE_SKIP:
+        used = length < payloadLeft_ ? length : payloadLeft_;
+        crc_ = navCrc32(crc_, data, used);
+        payloadLeft_ -= used;
+        if (payloadLeft_ == 0) state_ = STATE_CRC;
+        break;
+      case STATE_CRC:
+        used = crc(data, length, sink);
+        break;
+      default:
+        used = legacy(data, length, sink);
+        break;
+    }
+    data += used;
+    length -= used;
+  }
+}
+
+// Consumes bytes up to and including the fifth '>' of a start marker, or up
+// to (not including) a FRAME_HEADER byte, which starts the binary header.
+size_t NavDecoder::hunt(const uint8_t* data, size_t length, NavDecodeSink& sink) {
+  size_t i = 0;
+  while (i < length) {
+    if (startRun_ == 0) {
+      const uint8_t* marker = (const uint8_t*)memchr(data + i, '>', length - i);
+      const uint8_t* header = (const uint8_t*)memchr(data + i, FRAME_HEADER, (marker ? marker - data : length) - i);
+      if (header) {
+        state_ = STATE_HEADER;
+        partLen_ = 0;
+        return header - data;
+      }
+      if (!marker) return length;
+      i = marker - data;
+    }
+    if (data[i] != '>') {
+      startRun_ = 0;
+      continue;
+    }
+    i++;
+    if (++startRun_ == FRAME_MARKER_LEN) {
+      startRun_ = 0;
+      nav_ = &sink.beginFrame();
+      state_ = STATE_LEGACY;
+      legacyField_ = 0;
+      fieldPos_ = 0;
+      bitmapChanged_ = false;
+      pixelsReceived_ = false;
+      frameLen_ = 0;
+      endRun_ = 0;
+      return i;
+    }
+  }
+  return i;
+}
+
+size_t NavDecoder::header(const uint8_t* data, size_t length, NavDecodeSink& sink) {
+  size_t n = FRAME_BINARY_HEADER_LEN - partLen_;
+  if (n > length) n = length;
+  memcpy(part_ + partLen_, data, n);
+  partLen_ += n;
+  if (partLen_ < FRAME_BINARY_HEADER_LEN) return n;
+
+  partLen_ = 0;
+  crc_ = navCrc32(0, part_, FRAME_BINARY_HEADER_LEN);
+  version_ = part_[1];
+  command_ = part_[2];
+  payloadLeft_ = part_[3] | (part_[4] << 8);
+  if (payloadLeft_ > MAX_PAYLOAD) {
+    // Not a frame we could take; hunt on right after the header
+    finish(NAV_ERR_LENGTH, sink);
+    return n;
+  }
+  error_ = NAV_OK;
+  missingIcon_ = 0;
+  bitmapId_ = 0;
+  bitmapChanged_ = false;
+  pixelsReceived_ = false;
+  if (version_ != PROTOCOL_VERSION || command_ != CMD_NAV_UPDATE) {
+    // Only the CRC is of interest, to tell which error to report
+    state_ = payloadLeft_ ? STATE_SKIP : STATE_CRC;
+    return n;
+  }
+  nav_ = &sink.beginFrame();
+  baseId_ = nav_->hasBitmap ? nav_->bitmapId : 0;
+  state_ = payloadLeft_ ? STATE_FIELD_HEADER : STATE_CRC;
+  return n;
+}
+
+size_t NavDecoder::fieldHeader(const uint8_t* data, size_t length) {
+  if (partLen_ == 0 && payloadLeft_ < NAV_TLV_HEADER_LEN) {
+    fail(NAV_ERR_FIELD);
+    return 0;
+  }
+  size_t n = NAV_TLV_HEADER_LEN - partLen_;
+  if (n > length) n = length;
+  memcpy(part_ + partLen_, data, n);
+  partLen_ += n;
+  crc_ = navCrc32(crc_, data, n);
+  payloadLeft_ -= n;
+  if (partLen_ < NAV_TLV_HEADER_LEN) return n;
+
+  partLen_ = 0;
+  fieldType_ = part_[0];
+  fieldLen_ = part_[1] | (part_[2] << 8);
+  if (fieldLen_ > payloadLeft_) {
+    fail(NAV_ERR_FIELD);
+  } else {
+    beginField();
+  }
+  return n;
+}
+
+void NavDecoder::beginField() {
+  fieldPos_ = 0;
+  value_ = 0;
+  switch (fieldType_) {
+    case NAV_TLV_BITMAP_DELTA:
+      if (fieldLen_ < 2 + NAV_DELTA_MASK_BYTES) {
+        fail(NAV_ERR_FIELD);
+        return;
+      }
+      break;
+    case NAV_TLV_BITMAP_ID:
+      if (fieldLen_ != 2) {
+        fail(NAV_ERR_FIELD);
+        return;
+      }
+      break;
+    case NAV_TLV_ICON_REF:
+      if (fieldLen_ != 4) {
+        fail(NAV_ERR_FIELD);
+        return;
+      }
+      break;
+    case NAV_TLV_BITMAP_PACKBITS:
+      packBits_.reset(nav_->bitmap, BITMAP_BYTES);
+      packBitsOk_ = true;
+      break;
+    case NAV_TLV_TITLE:
+      text_ = nav_->title.buffer();
+      textCapacity_ = nav_->title.capacity();
+      break;
+    case NAV_TLV_ETA:
+      text_ = nav_->eta.buffer();
+      textCapacity_ = nav_->eta.capacity();
+      break;
+    case NAV_TLV_DISTANCE:
+      text_ = nav_->distance.buffer();
+      textCapacity_ = nav_->distance.capacity();
+      break;
+    default:
+      break;
+  }
+  state_ = STATE_FIELD;
+  if (fieldLen_ == 0) endField();
+}
+
+size_t NavDecoder::field(const uint8_t* data, size_t length) {
+  size_t n = fieldLen_ - fieldPos_;
+  if (n > length) n = length;
+  crc_ = navCrc32(crc_, data, n);
+  payloadLeft_ -= n;
+
+  switch (fieldType_) {
+    case NAV_TLV_BITMAP:
+      if (fieldPos_ < BITMAP_BYTES) {
+        memcpy(nav_->bitmap + fieldPos_, data, n < BITMAP_BYTES - fieldPos_ ? n : BITMAP_BYTES - fieldPos_);
+      }
+      break;
+    case NAV_TLV_BITMAP_PACKBITS:
+      if (packBitsOk_) packBitsOk_ = packBits_.feed(data, n);
+      break;
+    case NAV_TLV_BITMAP_DELTA:
+      applyDelta(data, n);
+      if (state_ != STATE_FIELD) return n;
+      break;
+    case NAV_TLV_BITMAP_ID:
+    case NAV_TLV_ICON_REF:
+      for (size_t i = 0; i < n; i++) value_ |= (uint32_t)data[i] << (8 * (fieldPos_ + i));
+      break;
+    case NAV_TLV_TITLE:
+    case NAV_TLV_ETA:
+    case NAV_TLV_DISTANCE:
+      if (fieldPos_ < textCapacity_) {
+        memcpy(text_ + fieldPos_, data, n < textCapacity_ - fieldPos_ ? n : textCapacity_ - fieldPos_);
+      }
+      break;
+    default:
+      // Unknown fields are skipped so newer apps can add them
+      break;
+  }
+  fieldPos_ += n;
+  if (fieldPos_ == fieldLen_) endField();
+  return n;
+}
+
+// Base id and tile mask first, checked as soon as they are in; then the
+// XOR data, tile by tile, into the bitmap
+void NavDecoder::applyDelta(const uint8_t* data, size_t length) {
+  size_t pos = fieldPos_;
+  while (length > 0 && pos < 2 + NAV_DELTA_MASK_BYTES) {
+    if (pos < 2) {
+      value_ |= (uint32_t)*data << (8 * pos);
+    } else {
+      deltaMask_[pos - 2] = *data;
+    }
+    data++;
+    length--;
+    pos++;
+    if (pos == 2 && (value_ == 0 || value_ != baseId_)) {
+      fail(NAV_ERR_DELTA_BASE);
+      return;
+    }
+    if (pos == 2 + NAV_DELTA_MASK_BYTES) {
+      size_t expected = 2 + NAV_DELTA_MASK_BYTES;
+      for (size_t tile = 0; tile < NAV_DELTA_TILES; tile++) {
+        if (deltaMask_[tile / 8] & (1 << (tile % 8))) expected += deltaTileBytes(tile);
+      }
+      if (expected != fieldLen_) {
+        fail(NAV_ERR_FIELD);
+        return;
+      }
+      deltaTile_ = 0;
+      nextDeltaTile();
+    }
+  }
+  while (length > 0) {
+    size_t n = length < deltaTileLeft_ ? length : deltaTileLeft_;
+    uint8_t* dst = nav_->bitmap + deltaTile_ * NAV_DELTA_TILE_BYTES + (deltaTileBytes(deltaTile_) - deltaTileLeft_);
+    for (size_t i = 0; i < n; i++) dst[i] ^= data[i];
+    data += n;
+    length -= n;
+    deltaTileLeft_ -= n;
+    if (deltaTileLeft_ == 0) {
+      deltaTile_++;
+      nextDeltaTile();
+    }
+  }
+}
+
+// Moves deltaTile_ to the first set tile at or after it
+void NavDecoder::nextDeltaTile() {
+  while (deltaTile_ < NAV_DELTA_TILES && !(deltaMask_[deltaTile_ / 8] & (1 << (deltaTile_ % 8)))) deltaTile_++;
+  deltaTileLeft_ = deltaTile_ < NAV_DELTA_TILES ? deltaTileBytes(deltaTile_) : 0;
+}
+
+void NavDecoder::endField() {
+  switch (fieldType_) {
+    case NAV_TLV_BITMAP:
+      if (fieldLen_ < BITMAP_BYTES) memset(nav_->bitmap + fieldLen_, 0, BITMAP_BYTES - fieldLen_);
+      nav_->hasBitmap = true;
+      bitmapChanged_ = true;
+      pixelsReceived_ = true;
+      break;
+    case NAV_TLV_BITMAP_PACKBITS:
+      if (!packBitsOk_ || !packBits_.idle() || packBits_.written() != BITMAP_BYTES) {
+        fail(NAV_ERR_FIELD);
+        return;
+      }
+      nav_->hasBitmap = true;
+      bitmapChanged_ = true;
+      pixelsReceived_ = true;
+      break;
+    case NAV_TLV_BITMAP_DELTA:
+      bitmapChanged_ = true;
+      pixelsReceived_ = true;
+      break;
+    case NAV_TLV_ICON_REF: {
+      const uint8_t* icon = icons_ ? icons_->find(value_) : nullptr;
+      if (!icon) {
+        missingIcon_ = value_;
+        fail(NAV_ERR_ICON_MISS);
+        return;
+      }
+      memcpy(nav_->bitmap, icon, BITMAP_BYTES);
+      nav_->hasBitmap = true;
+      bitmapChanged_ = true;
+      break;
+    }
+    case NAV_TLV_BITMAP_ID:
+      bitmapId_ = value_;
+      break;
+    case NAV_TLV_TITLE:
+      nav_->title.commit(fieldLen_);
+      break;
+    case NAV_TLV_ETA:
+      nav_->eta.commit(fieldLen_);
+      break;
+    case NAV_TLV_DISTANCE:
+      nav_->distance.commit(fieldLen_);
+      break;
+    default:
+      break;
+  }
+  state_ = payloadLeft_ ? STATE_FIELD_HEADER : STATE_CRC;
+}
+
+size_t NavDecoder::crc(const uint8_t* data, size_t length, NavDecodeSink& sink) {
+  size_t n = FRAME_BINARY_CRC_LEN - partLen_;
+  if (n > length) n = length;
+  memcpy(part_ + partLen_, data, n);
+  partLen_ += n;
+  if (partLen_ < FRAME_BINARY_CRC_LEN) return n;
+
+  partLen_ = 0;
+  uint32_t expected = part_[0] | (part_[1] << 8) | ((uint32_t)part_[2] << 16) | ((uint32_t)part_[3] << 24);
+  NavResult result = error_;
+  if (version_ != PROTOCOL_VERSION) {
+    result = NAV_ERR_VERSION;
+  } else if (expected != crc_) {
+    result = NAV_ERR_CRC;
+  } else if (command_ != CMD_NAV_UPDATE) {
+    result = NAV_ERR_COMMAND;
+  }
+  finish(result, sink);
+  return n;
+}
+
+// The rest of a payload goes unread once a field is bad; the CRC still
+// decides whether that is the error to report
+void NavDecoder::fail(NavResult result) {
+  if (error_ == NAV_OK) error_ = result;
+  partLen_ = 0;
+  state_ = payloadLeft_ ? STATE_SKIP : STATE_CRC;
+}
+
+void NavDecoder::finish(NavResult result, NavDecodeSink& sink) {
+  if (result == NAV_OK && nav_) {
+    if (bitmapChanged_) nav_->bitmapId = bitmapId_;
+    if (pixelsReceived_ && icons_) icons_->insert(IconCache::hash(nav_->bitmap), nav_->bitmap);
+  }
+  nav_ = nullptr;
+  state_ = STATE_HUNT;
+  sink.endFrame(result, result == NAV_ERR_ICON_MISS ? missingIcon_ : 0);
+}
+
+// Legacy body: bitmap up to the first ';', then title, ETA and distance
+// split at '|', up to the end marker. A run of '<' shorter than the marker
+// is held back until the next byte shows it was text.
+size_t NavDecoder::legacy(const uint8_t* data, size_t length, NavDecodeSink& sink) {
+  if (frameLen_ >= MAX_PAYLOAD) {
+    finish(NAV_ERR_LENGTH, sink);
+    return 0;
+  }
+  size_t n;
+  if (data[0] == '<') {
+    n = 1;
+    if (++endRun_ == FRAME_MARKER_LEN) {
+      endRun_ = 0;
+      if (legacyField_ == 0) {
+        finish(NAV_ERR_SEPARATOR, sink);
+        return n;
+      }
+      if (legacyField_ < 3) {
+        nav_->title = "N/A";
+        nav_->eta = "N/A";
+        nav_->distance = "N/A";
+      } else {
+        nav_->distance.commit(fieldPos_);
+      }
+      finish(NAV_OK, sink);
+      return n;
+    }
+  } else {
+    if (endRun_ > 0) {
+      legacyAppend(markerRun, endRun_);
+      endRun_ = 0;
+    }
+    const uint8_t* marker = (const uint8_t*)memchr(data, '<', length);
+    n = marker ? marker - data : length;
+    // Stop at the limit, so hunting resumes right after an oversized frame
+    if (n > MAX_PAYLOAD - frameLen_) n = MAX_PAYLOAD - frameLen_;
+    const uint8_t* separator = nullptr;
+    if (legacyField_ < 3) separator = (const uint8_t*)memchr(data, legacyField_ == 0 ? ';' : '|', n);
+    if (separator == data) {
+      legacyNextField();
+      n = 1;
+    } else {
+      if (separator) n = separator - data;
+      legacyAppend(data, n);
+    }
+  }
+  frameLen_ += n;
+  return n;
+}
+
+void NavDecoder::legacyAppend(const uint8_t* data, size_t length) {
+  if (legacyField_ == 0) {
+    if (fieldPos_ < BITMAP_BYTES) {
+      memcpy(nav_->bitmap + fieldPos_, data, length < BITMAP_BYTES - fieldPos_ ? length : BITMAP_BYTES - fieldPos_);
+    }
+  } else if (fieldPos_ < textCapacity_) {
+    memcpy(text_ + fieldPos_, data, length < textCapacity_ - fieldPos_ ? length : textCapacity_ - fieldPos_);
+  }
+  fieldPos_ += length;
+}
+
+void NavDecoder::legacyNextField() {
+  switch (legacyField_) {
+    case 0:
+      if (fieldPos_ < BITMAP_BYTES) memset(nav_->bitmap + fieldPos_, 0, BITMAP_BYTES - fieldPos_);
+      nav_->hasBitmap = true;
+      nav_->bitmapId = 0;
+      text_ = nav_->title.buffer();
+      textCapacity_ = nav_->title.capacity();
+      break;
+    case 1:
+      nav_->title.commit(fieldPos_);
+      text_ = nav_->eta.buffer();
+      textCapacity_ = nav_->eta.capacity();
+      break;
+    default:
+      nav_->eta.commit(fieldPos_);
+      text_ = nav_->distance.buffer();
+      textCapacity_ = nav_->distance.capacity();
+      break;
+  }
+  legacyField_++;
+  fieldPos_ = 0;
+}
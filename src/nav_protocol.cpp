@@ -0,0 +1,79 @@
+#include "nav_protocol.h"
+
+#include <string.h>
+#include "config.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_crc.h"
+#endif
+
+uint32_t navCrc32(uint32_t crc, const uint8_t* data, size_t length) {
+#ifdef ESP_PLATFORM
+  return esp_crc32_le(crc, data, length);
+#else
+  // Same reflected CRC-32 as the ROM routine, for host builds
+  crc = ~crc;
+  while (length--) {
+    crc ^= *data++;
+    for (int k = 0; k < 8; k++) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+#endif
+}
+
+const char* navResultString(NavResult result) {
+  switch (result) {
+    case NAV_OK: return "ok";
+    case NAV_ERR_SEPARATOR: return "separator not found";
+    case NAV_ERR_LENGTH: return "bad length";
+    case NAV_ERR_VERSION: return "unsupported version";
+    case NAV_ERR_CRC: return "CRC mismatch";
+    case NAV_ERR_COMMAND: return "unknown command";
+    case NAV_ERR_FIELD: return "malformed field";
+    case NAV_ERR_DELTA_BASE: return "delta base mismatch";
+    case NAV_ERR_ICON_MISS: return "icon not cached";
+  }
+  return "?";
+}
+
+NavFrameWriter::NavFrameWriter(uint8_t* buffer, size_t capacity, uint8_t command)
+    : buffer_(buffer), capacity_(capacity), length_(FRAME_BINARY_HEADER_LEN), overflow_(false) {
+  if (capacity < FRAME_BINARY_HEADER_LEN + FRAME_BINARY_CRC_LEN) {
+    overflow_ = true;
+    return;
+  }
+  buffer_[0] = FRAME_HEADER;
+  buffer_[1] = PROTOCOL_VERSION;
+  buffer_[2] = command;
+}
+
+void NavFrameWriter::addField(uint8_t type, const void* value, size_t length) {
+  if (overflow_ || length_ + NAV_TLV_HEADER_LEN + length + FRAME_BINARY_CRC_LEN > capacity_) {
+    overflow_ = true;
+    return;
+  }
+  buffer_[length_++] = type;
+  buffer_[length_++] = length & 0xFF;
+  buffer_[length_++] = length >> 8;
+  memcpy(buffer_ + length_, value, length);
+  length_ += length;
+}
+
+void NavFrameWriter::addU32(uint8_t type, uint32_t value) {
+  uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+  addField(type, bytes, sizeof(bytes));
+}
+
+size_t NavFrameWriter::finish() {
+  if (overflow_) return 0;
+  size_t payloadLen = length_ - FRAME_BINARY_HEADER_LEN;
+  buffer_[3] = payloadLen & 0xFF;
+  buffer_[4] = payloadLen >> 8;
+  uint32_t crc = navCrc32(0, buffer_, length_);
+  for (int i = 0; i < 4; i++) {
+    buffer_[length_++] = crc >> (8 * i);
+  }
+  return length_;
+}
@@ -0,0 +1,76 @@
+#include "packbits.h"
+
+#include <string.h>
+
+void PackBitsDecoder::reset(uint8_t* dst, size_t capacity) {
+  dst_ = dst;
+  capacity_ = capacity;
+  written_ = 0;
+  mode_ = MODE_CONTROL;
+  count_ = 0;
+  overrun_ = false;
+}
+
+bool PackBitsDecoder::feed(const uint8_t* src, size_t length) {
+  while (length > 0 && !overrun_) {
+    if (mode_ == MODE_CONTROL) {
+      int8_t n = (int8_t)*src++;
+      length--;
+      if (n >= 0) {
+        mode_ = MODE_LITERAL;
+        count_ = n + 1;
+      } else if (n != -128) {
+        mode_ = MODE_REPEAT;
+        count_ = 1 - n;
+      }
+      continue;
+    }
+
+    size_t n = count_;
+    if (written_ + n > capacity_) {
+      overrun_ = true;
+      break;
+    }
+    if (mode_ == MODE_LITERAL) {
+      if (n > length) n = length;
+      if (dst_) memcpy(dst_ + written_, src, n);
+      src += n;
+      length -= n;
+    } else {
+      if (dst_) memset(dst_ + written_, *src, n);
+      src++;
+      length--;
+    }
+    written_ += n;
+    count_ -= n;
+    if (count_ == 0) mode_ = MODE_CONTROL;
+  }
+  return !overrun_;
+}
+
+size_t packBitsEncode(const uint8_t* src, size_t length, uint8_t* dst) {
+  size_t in = 0;
+  size_t out = 0;
+  while (in < length) {
+    size_t run = 1;
+    while (in + run < length && run < 128 && src[in + run] == src[in]) run++;
+    if (run >= 2) {
+      dst[out++] = (uint8_t)(1 - (int)run);
+      dst[out++] = src[in];
+      in += run;
+      continue;
+    }
+    // Literal until the next run of three, which is worth breaking for
+    size_t lit = 1;
+    while (in + lit < length && lit < 128 &&
+           !(in + lit + 2 < length && src[in + lit] == src[in + lit + 1] &&
+             src[in + lit] == src[in + lit + 2])) {
+      lit++;
+    }
+    dst[out++] = (uint8_t)(lit - 1);
+    memcpy(dst + out, src + in, lit);
+    out += lit;
+    in += lit;
+  }
+  return out;
+}
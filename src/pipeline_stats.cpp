@@ -0,0 +1,79 @@
+#include "pipeline_stats.h"
+
+#ifdef ENABLE_PIPELINE_STATS
+
+#include "nav_protocol.h"
+
+static inline uint8_t bucketOf(uint32_t us) {
+  return us ? 31 - __builtin_clz(us) : 0;
+}
+
+void LatencyHistogram::record(uint32_t us) {
+  buckets_[bucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(us, std::memory_order_relaxed);
+  // One writer per histogram, so plain load/store is enough for min/max
+  if (us < min_.load(std::memory_order_relaxed)) min_.store(us, std::memory_order_relaxed);
+  if (us > max_.load(std::memory_order_relaxed)) max_.store(us, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_release);
+}
+
+StageSummary LatencyHistogram::summary() const {
+  StageSummary s = {0, 0, 0, 0, 0};
+  s.count = count_.load(std::memory_order_acquire);
+  if (s.count == 0) return s;
+  s.min = min_.load(std::memory_order_relaxed);
+  s.max = max_.load(std::memory_order_relaxed);
+  s.avg = sum_.load(std::memory_order_relaxed) / s.count;
+
+  uint32_t target = s.count - s.count / 100;
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < BUCKETS; b++) {
+    seen += buckets_[b].load(std::memory_order_relaxed);
+    if (seen >= target) {
+      s.p99 = b == 31 ? 0xFFFFFFFF : (2u << b) - 1;
+      break;
+    }
+  }
+  if (s.p99 > s.max) s.p99 = s.max;
+  return s;
+}
+
+void LatencyHistogram::reset() {
+  for (uint8_t b = 0; b < BUCKETS; b++) buckets_[b].store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store(0xFFFFFFFF, std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+  count_.store(0, std::memory_order_release);
+}
+
+void PipelineStats::reset() {
+  for (uint8_t i = 0; i < STAGE_COUNT; i++) stages_[i].reset();
+}
+
+size_t PipelineStats::writeFrame(uint8_t* buffer, size_t capacity) const {
+  NavFrameWriter writer(buffer, capacity, CMD_PIPELINE_STATS);
+  for (uint8_t i = 0; i < STAGE_COUNT; i++) {
+    StageSummary s = stages_[i].summary();
+    const uint32_t values[5] = {s.count, s.min, s.avg, s.max, s.p99};
+    uint8_t field[STATS_TLV_STAGE_LEN];
+    field[0] = i;
+    for (uint8_t v = 0; v < 5; v++) {
+      for (uint8_t k = 0; k < 4; k++) field[1 + v * 4 + k] = values[v] >> (8 * k);
+    }
+    writer.addField(STATS_TLV_STAGE, field, sizeof(field));
+  }
+  return writer.finish();
+}
+
+const char* PipelineStats::stageName(PipelineStage stage) {
+  switch (stage) {
+    case STAGE_ASSEMBLE: return "assemble";
+    case STAGE_PARSE:    return "parse";
+    case STAGE_QUEUE:    return "queue";
+    case STAGE_RENDER:   return "render";
+    case STAGE_TOTAL:    return "total";
+    default:             return "?";
+  }
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "text_layout.h"
+
+#include <string.h>
+#include "glyph_cache.h"
+
+// Advance of one code point, and how far its ink reaches when it ends a
+// line; the same two numbers u8g2_GetUTF8Width adds up
+static int16_t glyphAdvance(u8g2_t* u8g2, uint32_t cp, int16_t& ink) {
+  if (cp > 0xFFFF) {  // u8g2 fonts stop at the BMP
+    ink = 0;
+    return 0;
+  }
+  const Glyph& glyph = glyphCache.get(u8g2->font, cp);
+  ink = glyph.width ? glyph.width + glyph.xOffset : glyph.advance;
+  return glyph.advance;
+}
+
+static void addLine(TextLayout& layout, size_t start, size_t length) {
+  layout.lines[layout.lineCount].start = start;
+  layout.lines[layout.lineCount].length = length;
+  layout.lineCount++;
+}
+
+void layoutText(u8g2_t* u8g2, const char* text, int16_t maxWidth, TextLayout& layout) {
+  layout.lineCount = 0;
+  size_t lineStart = 0;
+  int32_t lineAdvance = 0;        // advances of everything on the line so far
+  long spaceAt = -1;              // last space on the line
+  int32_t advanceAfterSpace = 0;  // advances of what follows it
+
+  const char* p = text;
+  while (*p) {
+    size_t offset = p - text;
+    uint32_t cp = utf8Next(p);
+    int16_t ink;
+    int16_t dx = glyphAdvance(u8g2, cp, ink);
+
+    bool full = layout.lineCount == TEXT_LAYOUT_MAX_LINES - 1;
+    if (!full && offset > lineStart && lineAdvance + ink > maxWidth) {
+      if (cp == ' ') {
+        // The space that overflows is the break
+        addLine(layout, lineStart, offset - lineStart);
+        lineStart = p - text;
+        lineAdvance = 0;
+        spaceAt = -1;
+        continue;
+      }
+      if (spaceAt >= 0) {
+        addLine(layout, lineStart, spaceAt - lineStart);
+        lineStart = spaceAt + 1;
+        lineAdvance = advanceAfterSpace;
+        spaceAt = -1;
+        full = layout.lineCount == TEXT_LAYOUT_MAX_LINES - 1;
+      }
+      // A word wider than the line breaks before this code point
+      if (!full && offset > lineStart && lineAdvance + ink > maxWidth) {
+        addLine(layout, lineStart, offset - lineStart);
+        lineStart = offset;
+        lineAdvance = 0;
+      }
+    }
+
+    lineAdvance += dx;
+    if (cp == ' ') {
+      spaceAt = offset;
+      advanceAfterSpace = 0;
+    } else {
+      advanceAfterSpace += dx;
+    }
+  }
+  size_t end = p - text;
+  if (end > lineStart) addLine(layout, lineStart, end - lineStart);
+}
+
+void drawTextLine(u8g2_t* u8g2, int16_t x, int16_t y, const char* text, const TextLine& line) {
+  const char* p = text + line.start;
+  const char* end = p + line.length;
+  while (p < end) {
+    uint32_t cp = utf8Next(p);
+    if (cp <= 0xFFFF) x += drawGlyph(u8g2, x, y, cp);
+  }
+}
+
+const TextLayout& TextLayoutCache::get(u8g2_t* u8g2, const char* text, int16_t maxWidth) {
+  size_t length = strlen(text);
+  if (length > NAV_TITLE_MAX - 1) {
+    misses_++;
+    layoutText(u8g2, text, maxWidth, scratch_);
+    return scratch_;
+  }
+
+  clock_++;
+  Entry* victim = &entries_[0];
+  for (Entry& entry : entries_) {
+    if (entry.font == u8g2->font && entry.maxWidth == maxWidth && entry.text.size() == length &&
+        memcmp(entry.text.c_str(), text, length) == 0) {
+      entry.lastUse = clock_;
+      return entry.layout;
+    }
+    if (entry.lastUse < victim->lastUse) victim = &entry;
+  }
+
+  misses_++;
+  victim->font = u8g2->font;
+  victim->maxWidth = maxWidth;
+  victim->lastUse = clock_;
+  victim->text.assign(text, length);
+  layoutText(u8g2, victim->text.c_str(), maxWidth, victim->layout);
+  return victim->layout;
+}
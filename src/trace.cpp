@@ -0,0 +1,73 @@
+#include "trace.h"
+
+#include <string.h>
+
+static const uint8_t traceMagic[4] = {'N', 'V', 'T', 'R'};
+
+static size_t writeVarint(uint8_t* out, uint64_t value) {
+  size_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+void TraceWriter::begin(uint32_t nowUs) {
+  uint8_t header[TRACE_HEADER_LEN];
+  memcpy(header, traceMagic, sizeof(traceMagic));
+  header[4] = TRACE_VERSION;
+  output_(header, sizeof(header), nullptr, 0);
+  lastUs_ = nowUs;
+  started_ = true;
+}
+
+void TraceWriter::record(uint32_t nowUs, TraceEvent event, const uint8_t* data, size_t length) {
+  if (!started_) begin(nowUs);
+  uint8_t head[2 * TRACE_VARINT_MAX];
+  size_t n = writeVarint(head, (uint64_t)(nowUs - lastUs_) << 2 | event);
+  lastUs_ = nowUs;
+  if (event != TRACE_WRITE) {
+    output_(head, n, nullptr, 0);
+    return;
+  }
+  n += writeVarint(head + n, length);
+  output_(head, n, data, length);
+}
+
+TraceReader::TraceReader(const uint8_t* data, size_t length)
+    : data_(data), length_(length), offset_(TRACE_HEADER_LEN) {
+  valid_ = length >= TRACE_HEADER_LEN && memcmp(data, traceMagic, sizeof(traceMagic)) == 0 &&
+           data[4] == TRACE_VERSION;
+}
+
+bool TraceReader::readVarint(uint64_t& value) {
+  value = 0;
+  for (uint8_t shift = 0; offset_ < length_ && shift < 64; shift += 7) {
+    uint8_t byte = data_[offset_++];
+    value |= (uint64_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) return true;
+  }
+  return false;
+}
+
+bool TraceReader::next(TraceRecord& record) {
+  if (!valid_ || offset_ >= length_) return false;
+  uint64_t head;
+  if (!readVarint(head)) return false;
+  record.deltaUs = head >> 2;
+  record.event = (TraceEvent)(head & 3);
+  record.data = nullptr;
+  record.length = 0;
+  if (record.event == TRACE_WRITE) {
+    uint64_t length;
+    if (!readVarint(length) || length > length_ - offset_) return false;
+    record.data = data_ + offset_;
+    record.length = length;
+    offset_ += length;
+  } else if (record.event != TRACE_CONNECT && record.event != TRACE_DISCONNECT) {
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,82 @@
+#include "transfer_receiver.h"
+
+#include <string.h>
+
+void TransferReceiver::reset() {
+  held_ = 0;
+  next_ = 0;
+  sinceAck_ = 0;
+  ackDue_ = false;
+  resetCounters();
+}
+
+void TransferReceiver::advance() {
+  next_ = (next_ + 1) & TRANSFER_SEQ_MASK;
+  held_ >>= 1;
+  counters_.chunks++;
+  if (++sinceAck_ >= TRANSFER_ACK_EVERY) ackDue_ = true;
+}
+
+void TransferReceiver::receive(const uint8_t* data, size_t length, ChunkSink& sink) {
+  if (length < TRANSFER_HEADER_LEN || length > TRANSFER_HEADER_LEN + TRANSFER_CHUNK_MAX) {
+    counters_.malformed++;
+    return;
+  }
+  uint16_t word = data[0] | (data[1] << 8);
+  uint16_t seq = word & TRANSFER_SEQ_MASK;
+  if (word & TRANSFER_FLAG_ACK) ackDue_ = true;
+  data += TRANSFER_HEADER_LEN;
+  length -= TRANSFER_HEADER_LEN;
+
+  uint16_t offset = (seq - next_) & TRANSFER_SEQ_MASK;
+  if (offset >= TRANSFER_WINDOW) {
+    // Behind next_ the sender missed an ACK; ahead of the window it ignored
+    // the credit. Either way it needs to hear where the receiver stands.
+    if (offset > TRANSFER_SEQ_MASK / 2) {
+      counters_.duplicates++;
+    } else {
+      counters_.outOfWindow++;
+    }
+    ackDue_ = true;
+    return;
+  }
+
+  if (offset > 0) {
+    if (held_ & (1u << offset)) {
+      counters_.duplicates++;
+    } else {
+      uint8_t slot = seq & (TRANSFER_WINDOW - 1);
+      memcpy(slots_[slot], data, length);
+      lengths_[slot] = length;
+      held_ |= 1u << offset;
+      counters_.held++;
+      uint32_t holding = __builtin_popcount(held_);
+      if (holding > counters_.heldPeak) counters_.heldPeak = holding;
+    }
+    // The selective ACK tells the sender which chunks to send again
+    ackDue_ = true;
+    return;
+  }
+
+  sink.onChunk(data, length);
+  advance();
+  while (held_ & 1) {
+    uint8_t slot = next_ & (TRANSFER_WINDOW - 1);
+    sink.onChunk(slots_[slot], lengths_[slot]);
+    advance();
+  }
+}
+
+size_t TransferReceiver::ackFrame(uint8_t* buffer) {
+  uint16_t sack = held_ >> 1;
+  buffer[0] = (uint8_t)next_;
+  buffer[1] = (uint8_t)(next_ >> 8);
+  buffer[2] = (uint8_t)sack;
+  buffer[3] = (uint8_t)(sack >> 8);
+  // Slots holding chunks past a gap are not free for new ones
+  buffer[4] = TRANSFER_WINDOW - __builtin_popcount(held_);
+  sinceAck_ = 0;
+  ackDue_ = false;
+  counters_.acks++;
+  return TRANSFER_ACK_LEN;
+}
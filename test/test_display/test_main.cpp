@@ -0,0 +1,90 @@
+// Host tests for the retained-mode repaint: `pio test -e native -f test_display`.
+// Pixels poked into the page buffer outside any text stand in for other
+// content: a widget that is repainted clears them, one left alone keeps them.
+
+#include <unity.h>
+#include "config.h"
+#include "display.h"
+#include "hal.h"
+
+#ifdef USE_OLED_GME128128
+static const char* longTitle = "Tiếp tục đi thẳng vào Đại lộ Võ Văn Kiệt rồi rẽ phải vào Nguyễn Văn Linh";
+
+// Empty spots of each widget: the bitmap is blank, the distance text starts
+// right of x = 20 and the marquee draws from row 108 down
+#define BITMAP_SPOT_X   50
+#define BITMAP_SPOT_Y   50
+#define DISTANCE_SPOT_X 1
+#define DISTANCE_SPOT_Y 85
+#define TITLE_SPOT_X    127
+#define TITLE_SPOT_Y    105
+
+static NavFrame nav;
+
+static void poke(int16_t x, int16_t y) {
+  u8g2_DrawPixel(halOled(), x, y);
+}
+
+static bool pixel(int16_t x, int16_t y) {
+  u8g2_t* oled = halOled();
+  const uint8_t* buffer = u8g2_GetBufferPtr(oled);
+  return buffer[(y / 8) * u8g2_GetBufferTileWidth(oled) * 8 + x] & (1 << (y % 8));
+}
+
+static void pokeAll() {
+  poke(BITMAP_SPOT_X, BITMAP_SPOT_Y);
+  poke(DISTANCE_SPOT_X, DISTANCE_SPOT_Y);
+  poke(TITLE_SPOT_X, TITLE_SPOT_Y);
+}
+
+void setUp() {
+  displayBegin();
+  nav.clear();
+  nav.hasBitmap = false;
+  nav.title = longTitle;
+  nav.eta = "12:45";
+  nav.distance = "1.2 km";
+  updateDisplay(nav, false);
+  updateDisplay(nav, true);
+}
+
+void tearDown() {}
+
+void test_marquee_tick_repaints_title_only() {
+  TEST_ASSERT_TRUE(displayScrolling());
+  for (int tick = 0; tick < 5; tick++) {
+    pokeAll();
+    displayScrollTick();
+    updateDisplay(nav, true);
+    TEST_ASSERT_TRUE(pixel(BITMAP_SPOT_X, BITMAP_SPOT_Y));
+    TEST_ASSERT_TRUE(pixel(DISTANCE_SPOT_X, DISTANCE_SPOT_Y));
+    TEST_ASSERT_FALSE(pixel(TITLE_SPOT_X, TITLE_SPOT_Y));
+  }
+}
+
+void test_distance_change_leaves_title() {
+  pokeAll();
+  nav.distance = "1.1 km";
+  updateDisplay(nav, true);
+  TEST_ASSERT_FALSE(pixel(DISTANCE_SPOT_X, DISTANCE_SPOT_Y));
+  TEST_ASSERT_TRUE(pixel(TITLE_SPOT_X, TITLE_SPOT_Y));
+}
+
+void test_unchanged_frame_repaints_nothing() {
+  pokeAll();
+  updateDisplay(nav, true);
+  TEST_ASSERT_TRUE(pixel(BITMAP_SPOT_X, BITMAP_SPOT_Y));
+  TEST_ASSERT_TRUE(pixel(DISTANCE_SPOT_X, DISTANCE_SPOT_Y));
+  TEST_ASSERT_TRUE(pixel(TITLE_SPOT_X, TITLE_SPOT_Y));
+}
+#endif
+
+int main(int, char**) {
+  UNITY_BEGIN();
+#ifdef USE_OLED_GME128128
+  RUN_TEST(test_marquee_tick_repaints_title_only);
+  RUN_TEST(test_distance_change_leaves_title);
+  RUN_TEST(test_unchanged_frame_repaints_nothing);
+#endif
+  return UNITY_END();
+}
@@ -0,0 +1,134 @@
+// Host tests for icon references: `pio test -e native -f test_icon_cache`.
+// The decoder fills the cache from frames with pixels; a later reference to
+// one of them restores its bitmap, and a reference to anything else is
+// reported with the key the app is NACKed with.
+
+#include <string.h>
+#include <unity.h>
+#include "icon_cache.h"
+#include "nav_decoder.h"
+
+// Keeps the last frame the decoder reported, with the icon it was missing
+class LastFrameSink : public NavDecodeSink {
+public:
+  NavFrame& beginFrame() override {
+    scratch_ = current;
+    return scratch_;
+  }
+  void endFrame(NavResult result, uint32_t missingIcon) override {
+    if (result == NAV_OK) current = scratch_;
+    this->result = result;
+    this->missingIcon = missingIcon;
+    count++;
+  }
+
+  NavFrame current;
+  NavResult result = NAV_OK;
+  uint32_t missingIcon = 0;
+  size_t count = 0;
+
+private:
+  NavFrame scratch_;
+};
+
+static uint8_t stream[MAX_PAYLOAD + 64];
+static uint8_t bitmaps[ICON_CACHE_ENTRIES + 1][BITMAP_BYTES];
+
+static void pixelsFrame(NavDecoder& decoder, const uint8_t* bitmap, const char* title, NavDecodeSink& sink) {
+  NavFrameWriter writer(stream, sizeof(stream), CMD_NAV_UPDATE);
+  writer.addField(NAV_TLV_BITMAP, bitmap, BITMAP_BYTES);
+  writer.addField(NAV_TLV_TITLE, title, strlen(title));
+  decoder.push(stream, writer.finish(), sink);
+}
+
+static void refFrame(NavDecoder& decoder, uint32_t key, const char* title, NavDecodeSink& sink) {
+  NavFrameWriter writer(stream, sizeof(stream), CMD_NAV_UPDATE);
+  writer.addU32(NAV_TLV_ICON_REF, key);
+  writer.addField(NAV_TLV_TITLE, title, strlen(title));
+  decoder.push(stream, writer.finish(), sink);
+}
+
+void setUp() {
+  for (size_t i = 0; i <= ICON_CACHE_ENTRIES; i++) {
+    for (size_t j = 0; j < BITMAP_BYTES; j++) bitmaps[i][j] = (j / 11 + i) % 5 == 0 ? 0xFF : (uint8_t)(i * 7 + j);
+  }
+}
+
+void tearDown() {}
+
+void test_ref_hit_restores_bitmap() {
+  IconCache icons;
+  NavDecoder decoder(&icons);
+  LastFrameSink sink;
+  pixelsFrame(decoder, bitmaps[0], "Turn left", sink);
+  pixelsFrame(decoder, bitmaps[1], "Turn right", sink);
+  refFrame(decoder, IconCache::hash(bitmaps[0]), "Turn left again", sink);
+  TEST_ASSERT_EQUAL_UINT32(3, sink.count);
+  TEST_ASSERT_EQUAL_INT(NAV_OK, sink.result);
+  TEST_ASSERT_EQUAL_UINT32(0, sink.missingIcon);
+  TEST_ASSERT_TRUE(sink.current.hasBitmap);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmaps[0], sink.current.bitmap, BITMAP_BYTES);
+  TEST_ASSERT_EQUAL_STRING("Turn left again", sink.current.title.c_str());
+  TEST_ASSERT_EQUAL_UINT32(1, icons.hits());
+}
+
+void test_ref_miss_reports_key_and_keeps_frame() {
+  IconCache icons;
+  NavDecoder decoder(&icons);
+  LastFrameSink sink;
+  pixelsFrame(decoder, bitmaps[0], "Turn left", sink);
+  uint32_t key = IconCache::hash(bitmaps[1]);
+  refFrame(decoder, key, "Turn right", sink);
+  TEST_ASSERT_EQUAL_INT(NAV_ERR_ICON_MISS, sink.result);
+  TEST_ASSERT_EQUAL_UINT32(key, sink.missingIcon);
+  // Nothing of the missed frame shows until the pixels come
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmaps[0], sink.current.bitmap, BITMAP_BYTES);
+  TEST_ASSERT_EQUAL_STRING("Turn left", sink.current.title.c_str());
+  TEST_ASSERT_EQUAL_UINT32(0, icons.hits());
+}
+
+void test_nack_then_pixels_then_hit() {
+  IconCache icons;
+  NavDecoder decoder(&icons);
+  LastFrameSink sink;
+  uint32_t key = IconCache::hash(bitmaps[2]);
+  refFrame(decoder, key, "Turn right", sink);
+  TEST_ASSERT_EQUAL_INT(NAV_ERR_ICON_MISS, sink.result);
+  TEST_ASSERT_EQUAL_UINT32(key, sink.missingIcon);
+  // The app answers the NACK with the pixels, after which the ref is served
+  pixelsFrame(decoder, bitmaps[2], "Turn right", sink);
+  TEST_ASSERT_EQUAL_INT(NAV_OK, sink.result);
+  pixelsFrame(decoder, bitmaps[0], "Turn left", sink);
+  refFrame(decoder, key, "Turn right", sink);
+  TEST_ASSERT_EQUAL_INT(NAV_OK, sink.result);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmaps[2], sink.current.bitmap, BITMAP_BYTES);
+  TEST_ASSERT_EQUAL_UINT32(1, icons.hits());
+}
+
+void test_least_recently_used_is_evicted() {
+  IconCache icons;
+  NavDecoder decoder(&icons);
+  LastFrameSink sink;
+  for (size_t i = 0; i < ICON_CACHE_ENTRIES; i++) pixelsFrame(decoder, bitmaps[i], "Fill", sink);
+  // Using the oldest makes the second oldest the one to go
+  refFrame(decoder, IconCache::hash(bitmaps[0]), "Use", sink);
+  TEST_ASSERT_EQUAL_INT(NAV_OK, sink.result);
+  pixelsFrame(decoder, bitmaps[ICON_CACHE_ENTRIES], "Evict", sink);
+  refFrame(decoder, IconCache::hash(bitmaps[1]), "Evicted", sink);
+  TEST_ASSERT_EQUAL_INT(NAV_ERR_ICON_MISS, sink.result);
+  for (size_t i = 0; i <= ICON_CACHE_ENTRIES; i++) {
+    if (i == 1) continue;
+    refFrame(decoder, IconCache::hash(bitmaps[i]), "Kept", sink);
+    TEST_ASSERT_EQUAL_INT(NAV_OK, sink.result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmaps[i], sink.current.bitmap, BITMAP_BYTES);
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_ref_hit_restores_bitmap);
+  RUN_TEST(test_ref_miss_reports_key_and_keeps_frame);
+  RUN_TEST(test_nack_then_pixels_then_hit);
+  RUN_TEST(test_least_recently_used_is_evicted);
+  return UNITY_END();
+}
@@ -0,0 +1,177 @@
+// Host tests for LinkTuner: `pio test -e native -f test_link_tuner`.
+// Each test plays the app's part: it makes the request poll() returns,
+// reports whether it went out and then how the peer answered.
+
+#include <unity.h>
+#include "link_tuner.h"
+
+static LinkTuner tuner;
+
+void setUp() {
+  tuner.disconnect();
+}
+
+void tearDown() {}
+
+// Polls, expects `expected` and reports it sent
+static void expectSent(LinkRequest expected, uint32_t now) {
+  LinkRequest request = tuner.poll(now);
+  TEST_ASSERT_EQUAL_STRING(linkRequestName(expected), linkRequestName(request));
+  tuner.requested(request, true, now);
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(now));
+}
+
+// Connects and settles on 2M PHY and the fast profile
+static void connectFast(uint32_t now) {
+  tuner.connect(now);
+  expectSent(LINK_REQUEST_PHY_2M, now);
+  tuner.phyUpdated(true, now);
+  expectSent(LINK_REQUEST_FAST, now);
+  tuner.paramsUpdated(true, now);
+}
+
+void test_nothing_before_connect() {
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(0));
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, tuner.nextPollMs(0));
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_NONE, tuner.wanted(0));
+}
+
+void test_applied_only_once_accepted() {
+  tuner.connect(100);
+  expectSent(LINK_REQUEST_PHY_2M, 100);
+  // One procedure at a time
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, tuner.nextPollMs(100));
+  tuner.phyUpdated(true, 110);
+  TEST_ASSERT_FALSE(tuner.phyRefused());
+  expectSent(LINK_REQUEST_FAST, 110);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_NONE, tuner.applied());
+  tuner.paramsUpdated(true, 150);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_FAST, tuner.applied());
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(150));
+}
+
+void test_idle_relaxes_and_write_speeds_up() {
+  connectFast(0);
+  TEST_ASSERT_EQUAL_UINT32(LINK_IDLE_MS, tuner.nextPollMs(0));
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(LINK_IDLE_MS - 1));
+  expectSent(LINK_REQUEST_RELAXED, LINK_IDLE_MS);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_FAST, tuner.applied());
+  tuner.paramsUpdated(true, LINK_IDLE_MS + 50);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_RELAXED, tuner.applied());
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFFu, tuner.nextPollMs(LINK_IDLE_MS + 50));
+
+  uint32_t now = LINK_IDLE_MS + 1000;
+  tuner.write(now);
+  expectSent(LINK_REQUEST_FAST, now);
+  tuner.paramsUpdated(true, now);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_FAST, tuner.applied());
+}
+
+void test_write_after_now_keeps_fast() {
+  connectFast(0);
+  // The ingest task stamped a write after the render task read the clock
+  uint32_t now = LINK_IDLE_MS * 3;
+  tuner.write(now + 5);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_FAST, tuner.wanted(now));
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(now));
+  TEST_ASSERT_EQUAL_UINT32(LINK_IDLE_MS + 5, tuner.nextPollMs(now));
+}
+
+void test_refused_params_wait_for_next_profile() {
+  tuner.connect(0);
+  expectSent(LINK_REQUEST_PHY_2M, 0);
+  tuner.phyUpdated(true, 0);
+  expectSent(LINK_REQUEST_FAST, 0);
+  tuner.paramsUpdated(false, 20);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_NONE, tuner.applied());
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(20));
+  TEST_ASSERT_EQUAL_UINT32(LINK_IDLE_MS - 20, tuner.nextPollMs(20));
+  // Going idle asks for something else, which the peer may take
+  expectSent(LINK_REQUEST_RELAXED, LINK_IDLE_MS);
+  tuner.paramsUpdated(true, LINK_IDLE_MS);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_RELAXED, tuner.applied());
+  // and the fast profile is worth another try after that
+  tuner.write(LINK_IDLE_MS + 10);
+  expectSent(LINK_REQUEST_FAST, LINK_IDLE_MS + 10);
+}
+
+void test_busy_params_retried_after_back_off() {
+  tuner.connect(0);
+  expectSent(LINK_REQUEST_PHY_2M, 0);
+  tuner.phyUpdated(true, 0);
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_FAST, tuner.poll(0));
+  tuner.requested(LINK_REQUEST_FAST, false, 0);
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(LINK_RETRY_MS - 1));
+  TEST_ASSERT_EQUAL_UINT32(LINK_RETRY_MS, tuner.nextPollMs(0));
+  expectSent(LINK_REQUEST_FAST, LINK_RETRY_MS);
+  tuner.paramsUpdated(true, LINK_RETRY_MS);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_FAST, tuner.applied());
+}
+
+void test_refused_phy_retried_once() {
+  tuner.connect(0);
+  expectSent(LINK_REQUEST_PHY_2M, 0);
+  tuner.phyUpdated(false, 10);
+  TEST_ASSERT_FALSE(tuner.phyRefused());
+  // The parameters go ahead in the meantime
+  expectSent(LINK_REQUEST_FAST, 10);
+  tuner.paramsUpdated(true, 30);
+  TEST_ASSERT_EQUAL_UINT32(LINK_PHY_RETRY_MS - 20, tuner.nextPollMs(30));
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(10 + LINK_PHY_RETRY_MS - 1));
+  expectSent(LINK_REQUEST_PHY_2M, 10 + LINK_PHY_RETRY_MS);
+  tuner.phyUpdated(false, 20 + LINK_PHY_RETRY_MS);
+  TEST_ASSERT_TRUE(tuner.phyRefused());
+  // For the rest of the connection
+  uint32_t later = 100 * LINK_PHY_RETRY_MS;
+  tuner.write(later);
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(later));
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_FAST, tuner.applied());
+}
+
+void test_unsent_phy_counts_as_refused() {
+  tuner.connect(0);
+  for (uint8_t attempt = 0; attempt < LINK_PHY_ATTEMPTS; attempt++) {
+    uint32_t now = attempt * LINK_PHY_RETRY_MS;
+    TEST_ASSERT_EQUAL_INT(LINK_REQUEST_PHY_2M, tuner.poll(now));
+    tuner.requested(LINK_REQUEST_PHY_2M, false, now);
+  }
+  TEST_ASSERT_TRUE(tuner.phyRefused());
+}
+
+void test_unrequested_update_leaves_profile() {
+  connectFast(0);
+  // The central changed the parameters on its own
+  tuner.paramsUpdated(true, 10);
+  tuner.phyUpdated(false, 10);
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_FAST, tuner.applied());
+  TEST_ASSERT_FALSE(tuner.phyRefused());
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(10));
+}
+
+void test_reconnect_starts_over() {
+  connectFast(0);
+  tuner.disconnect();
+  TEST_ASSERT_EQUAL_INT(LINK_PROFILE_NONE, tuner.applied());
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_NONE, tuner.poll(10));
+  // A procedure cut off by the disconnect does not hold up the next link
+  tuner.connect(20);
+  expectSent(LINK_REQUEST_PHY_2M, 20);
+  tuner.disconnect();
+  tuner.connect(30);
+  TEST_ASSERT_EQUAL_INT(LINK_REQUEST_PHY_2M, tuner.poll(30));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_nothing_before_connect);
+  RUN_TEST(test_applied_only_once_accepted);
+  RUN_TEST(test_idle_relaxes_and_write_speeds_up);
+  RUN_TEST(test_write_after_now_keeps_fast);
+  RUN_TEST(test_refused_params_wait_for_next_profile);
+  RUN_TEST(test_busy_params_retried_after_back_off);
+  RUN_TEST(test_refused_phy_retried_once);
+  RUN_TEST(test_unsent_phy_counts_as_refused);
+  RUN_TEST(test_unrequested_update_leaves_profile);
+  RUN_TEST(test_reconnect_starts_over);
+  return UNITY_END();
+}
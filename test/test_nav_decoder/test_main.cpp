@@ -0,0 +1,303 @@
+// Host tests for NavDecoder: `pio test -e native -f test_nav_decoder`.
+// Frames are fed in randomly sized writes, so every field boundary, the
+// binary header, the CRC and the legacy markers end up split somewhere.
+
+#include <string.h>
+#include <unity.h>
+#include "nav_decoder.h"
+
+#define RUNS 200
+
+struct Decoded {
+  NavResult result;
+  NavFrame nav;
+};
+
+// Keeps every frame the decoder reports; a frame that checks out becomes
+// the state the next one starts from, as with the app's triple buffer
+class RecordingSink : public NavDecodeSink {
+public:
+  NavFrame& beginFrame() override {
+    scratch_ = current;
+    return scratch_;
+  }
+  void endFrame(NavResult result, uint32_t) override {
+    if (result == NAV_OK) current = scratch_;
+    if (count < sizeof(frames) / sizeof(frames[0])) {
+      frames[count].result = result;
+      frames[count].nav = current;
+    }
+    count++;
+  }
+
+  NavFrame current;
+  Decoded frames[8];
+  size_t count = 0;
+
+private:
+  NavFrame scratch_;
+};
+
+static uint32_t rngState;
+
+static uint32_t rng() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static void makeBitmap(uint8_t* bitmap, uint32_t seed) {
+  for (size_t i = 0; i < BITMAP_BYTES; i++) {
+    // Long runs, as in an arrow, with a sprinkle of '<', '>', ';' and 0xAA
+    // that must not be taken for markers
+    bitmap[i] = (i / 37 + seed) % 3 == 0 ? 0xFF : (i % 29 == 0 ? "<>;\xAA"[(i / 29 + seed) % 4] : 0);
+  }
+}
+
+static size_t binaryFrame(uint8_t* buffer, size_t capacity, const uint8_t* bitmap, const char* title,
+                          const char* eta, const char* distance) {
+  NavFrameWriter writer(buffer, capacity, CMD_NAV_UPDATE);
+  writer.addField(NAV_TLV_BITMAP, bitmap, BITMAP_BYTES);
+  writer.addField(NAV_TLV_TITLE, title, strlen(title));
+  writer.addField(NAV_TLV_ETA, eta, strlen(eta));
+  writer.addField(NAV_TLV_DISTANCE, distance, strlen(distance));
+  return writer.finish();
+}
+
+static size_t legacyFrame(uint8_t* buffer, const uint8_t* bitmap, const char* title, const char* eta,
+                          const char* distance) {
+  size_t n = 0;
+  memcpy(buffer, ">>>>>", FRAME_MARKER_LEN);
+  n += FRAME_MARKER_LEN;
+  for (size_t i = 0; i < BITMAP_BYTES; i++) {
+    // A legacy bitmap cannot hold ';' or a '<' run that reads as the end
+    buffer[n++] = bitmap[i] == ';' || bitmap[i] == '<' ? 0 : bitmap[i];
+  }
+  n += sprintf((char*)buffer + n, ";%s|%s|%s<<<<<", title, eta, distance);
+  return n;
+}
+
+// Pushes `length` bytes as writes of 1 to `maxChunk` bytes
+static void pushFragmented(NavDecoder& decoder, const uint8_t* data, size_t length, size_t maxChunk,
+                           NavDecodeSink& sink) {
+  while (length > 0) {
+    size_t n = 1 + rng() % maxChunk;
+    if (n > length) n = length;
+    decoder.push(data, n, sink);
+    data += n;
+    length -= n;
+  }
+}
+
+static void assertFrame(const Decoded& decoded, const uint8_t* bitmap, const char* title, const char* eta,
+                        const char* distance) {
+  TEST_ASSERT_EQUAL_INT(NAV_OK, decoded.result);
+  TEST_ASSERT_TRUE(decoded.nav.hasBitmap);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(bitmap, decoded.nav.bitmap, BITMAP_BYTES);
+  TEST_ASSERT_EQUAL_STRING(title, decoded.nav.title.c_str());
+  TEST_ASSERT_EQUAL_STRING(eta, decoded.nav.eta.c_str());
+  TEST_ASSERT_EQUAL_STRING(distance, decoded.nav.distance.c_str());
+}
+
+static uint8_t stream[5 * (MAX_PAYLOAD + 64)];
+static uint8_t bitmapA[BITMAP_BYTES];
+static uint8_t bitmapB[BITMAP_BYTES];
+
+void setUp() {
+  makeBitmap(bitmapA, 0);
+  makeBitmap(bitmapB, 1);
+}
+
+void tearDown() {}
+
+void test_binary_frames_any_split() {
+  for (uint32_t run = 0; run < RUNS; run++) {
+    rngState = run + 1;
+    size_t first = binaryFrame(stream, sizeof(stream), bitmapA, "Đường Nguyễn Văn Linh", "12:45", "1.2 km");
+    size_t length = first + binaryFrame(stream + first, sizeof(stream) - first, bitmapB, "Turn left", "12:46", "350 m");
+    RecordingSink sink;
+    NavDecoder decoder;
+    // Small writes in half the runs, so the header, TLV headers and CRC split
+    pushFragmented(decoder, stream, length, run % 2 ? 16 : 300, sink);
+    TEST_ASSERT_EQUAL_UINT32(2, sink.count);
+    assertFrame(sink.frames[0], bitmapA, "Đường Nguyễn Văn Linh", "12:45", "1.2 km");
+    assertFrame(sink.frames[1], bitmapB, "Turn left", "12:46", "350 m");
+    TEST_ASSERT_FALSE(decoder.receiving());
+  }
+}
+
+void test_binary_frame_every_two_way_split() {
+  size_t length = binaryFrame(stream, sizeof(stream), bitmapA, "Title", "ETA", "Distance");
+  for (size_t split = 1; split < length; split++) {
+    RecordingSink sink;
+    NavDecoder decoder;
+    decoder.push(stream, split, sink);
+    TEST_ASSERT_EQUAL_UINT32(0, sink.count);
+    decoder.push(stream + split, length - split, sink);
+    TEST_ASSERT_EQUAL_UINT32(1, sink.count);
+    assertFrame(sink.frames[0], bitmapA, "Title", "ETA", "Distance");
+  }
+}
+
+void test_legacy_frames_any_split() {
+  for (uint32_t run = 0; run < RUNS; run++) {
+    rngState = run + 1;
+    size_t first = legacyFrame(stream, bitmapA, "Rẽ trái", "12:45", "1.2 km");
+    size_t length = first + legacyFrame(stream + first, bitmapB, "Title", "12:46", "350 m");
+    uint8_t expectedA[BITMAP_BYTES];
+    uint8_t expectedB[BITMAP_BYTES];
+    memcpy(expectedA, stream + FRAME_MARKER_LEN, BITMAP_BYTES);
+    memcpy(expectedB, stream + first + FRAME_MARKER_LEN, BITMAP_BYTES);
+    RecordingSink sink;
+    NavDecoder decoder;
+    pushFragmented(decoder, stream, length, run % 2 ? 7 : 300, sink);
+    TEST_ASSERT_EQUAL_UINT32(2, sink.count);
+    assertFrame(sink.frames[0], expectedA, "Rẽ trái", "12:45", "1.2 km");
+    assertFrame(sink.frames[1], expectedB, "Title", "12:46", "350 m");
+  }
+}
+
+void test_corrupt_crc_is_rejected() {
+  size_t length = binaryFrame(stream, sizeof(stream), bitmapA, "Title", "ETA", "Distance");
+  for (uint32_t run = 0; run < RUNS; run++) {
+    rngState = run + 1;
+    static uint8_t corrupt[MAX_PAYLOAD + 64];
+    memcpy(corrupt, stream, length);
+    // Anywhere past the header, which would fail on its own terms
+    size_t at = FRAME_BINARY_HEADER_LEN + rng() % (length - FRAME_BINARY_HEADER_LEN);
+    corrupt[at] ^= 1 << (rng() % 8);
+    RecordingSink sink;
+    NavDecoder decoder;
+    pushFragmented(decoder, corrupt, length, 64, sink);
+    TEST_ASSERT_EQUAL_UINT32(1, sink.count);
+    TEST_ASSERT_EQUAL_INT(NAV_ERR_CRC, sink.frames[0].result);
+    TEST_ASSERT_FALSE(sink.current.hasBitmap);
+    TEST_ASSERT_EQUAL_STRING("N/A", sink.current.title.c_str());
+    // Nothing of the bad frame is left over for the next one
+    pushFragmented(decoder, stream, length, 64, sink);
+    TEST_ASSERT_EQUAL_UINT32(2, sink.count);
+    assertFrame(sink.frames[1], bitmapA, "Title", "ETA", "Distance");
+  }
+}
+
+static size_t addNoise(uint8_t* buffer) {
+  size_t n = rng() % 100;
+  for (size_t i = 0; i < n; i++) {
+    // Noise that holds no marker or header byte
+    uint8_t b = rng();
+    buffer[i] = b == FRAME_HEADER || b == '>' ? 0 : b;
+  }
+  return n;
+}
+
+void test_resyncs_after_garbage() {
+  for (uint32_t run = 0; run < RUNS; run++) {
+    rngState = run + 1;
+    size_t length = addNoise(stream);
+    length += binaryFrame(stream + length, sizeof(stream) - length, bitmapA, "One", "1", "1 m");
+    length += addNoise(stream + length);
+    // A frame cut short: its header claims more than follows, so the idle
+    // bytes after it are read as its payload and CRC, which then fails
+    size_t cut = binaryFrame(stream + length, sizeof(stream) - length, bitmapB, "Lost", "2", "2 m");
+    length += FRAME_BINARY_HEADER_LEN + rng() % (cut - FRAME_BINARY_HEADER_LEN);
+    memset(stream + length, 0, MAX_PAYLOAD + FRAME_BINARY_CRC_LEN);
+    length += MAX_PAYLOAD + FRAME_BINARY_CRC_LEN;
+    length += binaryFrame(stream + length, sizeof(stream) - length, bitmapB, "Two", "3", "3 m");
+    length += addNoise(stream + length);
+    size_t legacyStart = length;
+    length += legacyFrame(stream + length, bitmapA, "Three", "4", "4 m");
+    uint8_t expected[BITMAP_BYTES];
+    memcpy(expected, stream + legacyStart + FRAME_MARKER_LEN, BITMAP_BYTES);
+
+    RecordingSink sink;
+    NavDecoder decoder;
+    pushFragmented(decoder, stream, length, 100, sink);
+    TEST_ASSERT_EQUAL_UINT32(4, sink.count);
+    assertFrame(sink.frames[0], bitmapA, "One", "1", "1 m");
+    TEST_ASSERT_EQUAL_INT(NAV_ERR_CRC, sink.frames[1].result);
+    assertFrame(sink.frames[2], bitmapB, "Two", "3", "3 m");
+    assertFrame(sink.frames[3], expected, "Three", "4", "4 m");
+  }
+}
+
+void test_one_write_holds_many_frames() {
+  size_t length = 0;
+  for (int i = 0; i < 3; i++) {
+    length += binaryFrame(stream + length, sizeof(stream) - length, i % 2 ? bitmapB : bitmapA, "Title", "ETA", "1 m");
+  }
+  RecordingSink sink;
+  NavDecoder decoder;
+  decoder.push(stream, length, sink);
+  TEST_ASSERT_EQUAL_UINT32(3, sink.count);
+  assertFrame(sink.frames[0], bitmapA, "Title", "ETA", "1 m");
+  assertFrame(sink.frames[1], bitmapB, "Title", "ETA", "1 m");
+  assertFrame(sink.frames[2], bitmapA, "Title", "ETA", "1 m");
+}
+
+void test_oversized_binary_frame_is_rejected() {
+  for (uint32_t run = 0; run < RUNS; run++) {
+    rngState = run + 1;
+    // A header claiming more than any frame may hold, then a good frame
+    size_t payload = MAX_PAYLOAD + 1 + rng() % 1000;
+    uint8_t header[FRAME_BINARY_HEADER_LEN] = {FRAME_HEADER, PROTOCOL_VERSION, CMD_NAV_UPDATE, (uint8_t)payload,
+                                               (uint8_t)(payload >> 8)};
+    memcpy(stream, header, sizeof(header));
+    size_t length = sizeof(header);
+    length += binaryFrame(stream + length, sizeof(stream) - length, bitmapA, "Title", "ETA", "Distance");
+    RecordingSink sink;
+    NavDecoder decoder;
+    pushFragmented(decoder, stream, length, 64, sink);
+    TEST_ASSERT_EQUAL_UINT32(2, sink.count);
+    TEST_ASSERT_EQUAL_INT(NAV_ERR_LENGTH, sink.frames[0].result);
+    assertFrame(sink.frames[1], bitmapA, "Title", "ETA", "Distance");
+  }
+}
+
+void test_oversized_legacy_frame_is_rejected() {
+  for (uint32_t run = 0; run < RUNS; run++) {
+    rngState = run + 1;
+    // A start marker and more text than a frame may hold, never ended
+    memcpy(stream, ">>>>>", FRAME_MARKER_LEN);
+    size_t length = FRAME_MARKER_LEN;
+    memset(stream + length, 'x', MAX_PAYLOAD + 10);
+    length += MAX_PAYLOAD + 10;
+    size_t legacyStart = length;
+    length += legacyFrame(stream + length, bitmapB, "Title", "ETA", "Distance");
+    uint8_t expected[BITMAP_BYTES];
+    memcpy(expected, stream + legacyStart + FRAME_MARKER_LEN, BITMAP_BYTES);
+    RecordingSink sink;
+    NavDecoder decoder;
+    pushFragmented(decoder, stream, length, 300, sink);
+    TEST_ASSERT_EQUAL_UINT32(2, sink.count);
+    TEST_ASSERT_EQUAL_INT(NAV_ERR_LENGTH, sink.frames[0].result);
+    assertFrame(sink.frames[1], expected, "Title", "ETA", "Distance");
+  }
+}
+
+void test_reset_drops_partial_frame() {
+  size_t length = binaryFrame(stream, sizeof(stream), bitmapA, "Title", "ETA", "Distance");
+  RecordingSink sink;
+  NavDecoder decoder;
+  decoder.push(stream, length / 2, sink);
+  TEST_ASSERT_TRUE(decoder.receiving());
+  decoder.reset();
+  TEST_ASSERT_FALSE(decoder.receiving());
+  decoder.push(stream, length, sink);
+  TEST_ASSERT_EQUAL_UINT32(1, sink.count);
+  assertFrame(sink.frames[0], bitmapA, "Title", "ETA", "Distance");
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_binary_frames_any_split);
+  RUN_TEST(test_binary_frame_every_two_way_split);
+  RUN_TEST(test_legacy_frames_any_split);
+  RUN_TEST(test_corrupt_crc_is_rejected);
+  RUN_TEST(test_resyncs_after_garbage);
+  RUN_TEST(test_one_write_holds_many_frames);
+  RUN_TEST(test_oversized_binary_frame_is_rejected);
+  RUN_TEST(test_oversized_legacy_frame_is_rejected);
+  RUN_TEST(test_reset_drops_partial_frame);
+  return UNITY_END();
+}
@@ -0,0 +1,14 @@
+# PlatformIO post-script for env:bench: `pio run -e bench -t bench` builds
+# the benchmarks and checks them against bench/baseline.txt, failing on a
+# regression.
+Import("env")
+
+program = "$BUILD_DIR/${PROGNAME}${PROGSUFFIX}"
+
+env.AddCustomTarget(
+    name="bench",
+    dependencies=program,
+    actions='cd "$PROJECT_DIR" && "%s" --baseline bench/baseline.txt' % program,
+    title="Bench",
+    description="Run the benchmarks against bench/baseline.txt",
+)
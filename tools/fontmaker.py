@@ -1,114 +1,437 @@
-import sys
+"""Build a subsetted U8g2 font header from a BDF (or TTF/OTF) font.
+
+    python tools/fontmaker.py <font.bdf|font.ttf> <out.h> [options]
+
+    --name <symbol>     array name (default: the output file's stem)
+    --chars <sets>      comma separated: ascii, digits, vietnamese, nav
+                        (default: nav = ascii + vietnamese + punctuation)
+    --text <file>       also include every character in this UTF-8 file
+    --size <px>         pixel size when rasterizing a TTF/OTF (default 22)
+    --compare <file.h>  report the saving against an existing font header
+
+The output uses the same format as bdfconv (BBX mode 0, RLE bitmaps, the
+unicode lookup table) and can replace a header made with it. TTF/OTF input
+needs Pillow; without it, convert to BDF first (e.g. otf2bdf).
+
+U+FFFD is always included, so the firmware has something to draw for a
+character the subset left out; a font without one gets a hollow box. The
+glyphs of the source font that were left out are listed as ranges.
+"""
 import os
+import re
+import sys
+import unicodedata
 
-class FontConverter:
-    def __init__(self):
-        # Predefined glyph bitmaps (8x8) for demonstration
-        # In a real scenario, these would be derived from TTF contours
-        self.glyphs = {
-            'A': [
-                0b00011000,
-                0b00111100,
-                0b01100110,
-                0b11000011,
-                0b11111111,
-                0b11000011,
-                0b11000011,
-                0b00000000
-            ],
-            'B': [
-                0b11111100,
-                0b11000110,
-                0b11000110,
-                0b11111100,
-                0b11000110,
-                0b11000110,
-                0b11111100,
-                0b00000000
-            ]
-        }
-        self.point_size = 12
-        self.pixels_per_em = 8  # Simplified resolution
-
-    def generate_bdf(self, output_path):
-        """Generate a BDF file from predefined glyph data"""
-        try:
-            bdf_lines = []
-            # BDF header
-            bdf_lines.append("STARTFONT 2.1")
-            bdf_lines.append(f"FONT -Custom-Font-Medium-R-Normal--{self.point_size}-120-75-75-M-70-ISO10646-1")
-            bdf_lines.append(f"SIZE {self.point_size} 75 75")
-            bdf_lines.append(f"FONTBOUNDINGBOX {self.pixels_per_em} {self.pixels_per_em} 0 -2")
-            bdf_lines.append(f"CHARS {len(self.glyphs)}")
-
-            # Add each character
-            for char, bitmap in self.glyphs.items():
-                self.add_char(bdf_lines, char, bitmap)
-
-            bdf_lines.append("ENDFONT")
-
-            # Write to file
-            with open(output_path, 'w', encoding='utf-8') as f:
-                f.write("\n".join(bdf_lines))
-            
-            print(f"Successfully generated {output_path}")
-            return True
-
-        except Exception as e:
-            print(f"Error generating BDF: {str(e)}")
-            return False
-
-    def add_char(self, bdf_lines, char, bitmap):
-        """Add a single character definition to BDF"""
-        encoding = ord(char)
-        bdf_lines.append(f"STARTCHAR {char}")
-        bdf_lines.append(f"ENCODING {encoding}")
-        bdf_lines.append("SWIDTH 500 0")  # Scalable width (simplified)
-        bdf_lines.append(f"DWIDTH {self.pixels_per_em} 0")  # Device width
-        bdf_lines.append(f"BBX {self.pixels_per_em} {self.pixels_per_em} 0 -2")  # Bounding box
-        bdf_lines.append("BITMAP")
-        
-        for row in bitmap:
-            # Convert binary to 2-digit hex
-            bdf_lines.append(f"{row:02X}")
-        
-        bdf_lines.append("ENDCHAR")
-
-def convert_font(input_path, output_path):
-    """Main conversion function"""
+VIETNAMESE_BASES = "aăâeêioôơuưy"
+VIETNAMESE_TONES = "̣̀́̃̉"  # grave, acute, tilde, hook, dot
+
+
+def vietnamese_chars():
+    # The bare tone marks too, for text that arrives decomposed (NFD)
+    chars = set("đĐ") | set(VIETNAMESE_TONES)
+    for base in VIETNAMESE_BASES:
+        for letter in (base, base.upper()):
+            chars.add(letter)
+            for tone in VIETNAMESE_TONES:
+                chars.add(unicodedata.normalize("NFC", letter + tone))
+    return chars
+
+
+CHAR_SETS = {
+    "ascii": lambda: set(chr(c) for c in range(0x20, 0x7F)),
+    "digits": lambda: set("0123456789 .,:-/kmhpút"),
+    "vietnamese": vietnamese_chars,
+}
+# Typographic punctuation that shows up in place names and instructions
+PUNCTUATION = "\u00a0\u00b0\u00b7\u2013\u2014\u2018\u2019\u201c\u201d\u2026"
+CHAR_SETS["nav"] = lambda: CHAR_SETS["ascii"]() | CHAR_SETS["vietnamese"]() | set(PUNCTUATION)
+
+
+# Drawn by the firmware (GLYPH_FALLBACK) for a character the font lacks
+FALLBACK = 0xFFFD
+
+
+class Glyph:
+    """One glyph cropped to its ink: rows of 0/1, top row first."""
+
+    def __init__(self, encoding, advance, x, y, rows):
+        self.encoding = encoding
+        self.advance = advance
+        self.x = x  # left edge relative to the pen
+        self.y = y  # bottom edge relative to the baseline
+        self.rows = rows
+        self.crop()
+
+    @property
+    def width(self):
+        return len(self.rows[0]) if self.rows else 0
+
+    @property
+    def height(self):
+        return len(self.rows)
+
+    def crop(self):
+        rows = self.rows
+        while rows and not any(rows[-1]):
+            rows = rows[:-1]
+            self.y += 1
+        while rows and not any(rows[0]):
+            rows = rows[1:]
+        if not rows:
+            self.rows = []
+            self.x = self.y = 0
+            return
+        while not any(row[0] for row in rows):
+            rows = [row[1:] for row in rows]
+            self.x += 1
+        while not any(row[-1] for row in rows):
+            rows = [row[:-1] for row in rows]
+        self.rows = rows
+
+
+def read_bdf(path):
+    glyphs = {}
+    name = None
+    with open(path, "r", encoding="latin-1") as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        if line.startswith("FONT "):
+            name = line[5:].strip()
+        if not line.startswith("STARTCHAR"):
+            continue
+        encoding, advance, bbx = -1, 0, (0, 0, 0, 0)
+        for line in lines:
+            key, _, value = line.partition(" ")
+            if key == "ENCODING":
+                encoding = int(value.split()[0])
+            elif key == "DWIDTH":
+                advance = int(value.split()[0])
+            elif key == "BBX":
+                bbx = tuple(int(v) for v in value.split())
+            elif key == "BITMAP":
+                break
+        w, h, x, y = bbx
+        rows = []
+        for line in lines:
+            if line.startswith("ENDCHAR"):
+                break
+            bits = int(line, 16)
+            total = len(line.strip()) * 4
+            rows.append([(bits >> (total - 1 - i)) & 1 for i in range(w)])
+        if 0 <= encoding <= 0xFFFF:
+            glyphs[encoding] = Glyph(encoding, advance, x, y, rows[:h])
+    return name or os.path.basename(path), glyphs
+
+
+def read_ttf(path, size, chars):
     try:
-        # Basic input validation
-        if not os.path.exists(input_path):
-            raise FileNotFoundError(f"Input file not found: {input_path}")
-        if not input_path.lower().endswith(('.ttf', '.otf')):
-            raise ValueError("Input must be .ttf or .otf")
-
-        # Note: This doesn't actually parse the TTF/OTF yet
-        # It uses predefined glyphs for demonstration
-        converter = FontConverter()
-        success = converter.generate_bdf(output_path)
-        
-        if success:
-            print(f"Converted {input_path} to {output_path} (using demo glyphs)")
+        from PIL import ImageFont
+    except ImportError:
+        raise SystemExit("TTF/OTF input needs Pillow (pip install pillow); or convert to BDF first")
+    font = ImageFont.truetype(path, size)
+    ascent, _ = font.getmetrics()
+    glyphs = {}
+    for ch in chars:
+        mask = font.getmask(ch, mode="1")
+        w, h = mask.size
+        left, top, _, _ = font.getbbox(ch)
+        rows = [[1 if mask.getpixel((x, y)) else 0 for x in range(w)] for y in range(h)]
+        glyphs[ord(ch)] = Glyph(ord(ch), round(font.getlength(ch)), left, ascent - top - h, rows)
+    return "%s %dpx" % (os.path.basename(path), size), glyphs
+
+
+class BitWriter:
+    """LSB first, as u8g2 reads them."""
+
+    def __init__(self):
+        self.data = bytearray()
+        self.bits = 0
+
+    def put(self, count, value):
+        for i in range(count):
+            if self.bits % 8 == 0:
+                self.data.append(0)
+            if (value >> i) & 1:
+                self.data[-1] |= 1 << (self.bits % 8)
+            self.bits += 1
+
+
+def unsigned_bits(values):
+    top = max(values, default=0)
+    bits = 1
+    while top >= 1 << bits:
+        bits += 1
+    return bits
+
+
+def signed_bits(values):
+    bits = 1
+    while any(not -(1 << (bits - 1)) <= v < 1 << (bits - 1) for v in values):
+        bits += 1
+    return bits
+
+
+class Encoder:
+    def __init__(self, glyphs):
+        self.glyphs = glyphs
+        self.width_bits = unsigned_bits(g.width for g in glyphs)
+        self.height_bits = unsigned_bits(g.height for g in glyphs)
+        self.x_bits = signed_bits([g.x for g in glyphs])
+        self.y_bits = signed_bits([g.y for g in glyphs])
+        self.advance_bits = signed_bits([g.advance for g in glyphs])
+        # The run length field sizes that give the smallest font
+        self.bits_0, self.bits_1 = min(
+            ((b0, b1) for b0 in range(2, 9) for b1 in range(1, 8)),
+            key=lambda b: sum(len(self.encode(g, *b)) for g in glyphs))
+
+    def encode(self, glyph, bits_0, bits_1):
+        out = BitWriter()
+        out.put(self.width_bits, glyph.width)
+        out.put(self.height_bits, glyph.height)
+        out.put(self.x_bits, glyph.x + (1 << (self.x_bits - 1)))
+        out.put(self.y_bits, glyph.y + (1 << (self.y_bits - 1)))
+        out.put(self.advance_bits, glyph.advance + (1 << (self.advance_bits - 1)))
+        if not glyph.width:
+            return out.data
+
+        max_0, max_1 = (1 << bits_0) - 1, (1 << bits_1) - 1
+        last = []
+
+        def pair(a, b):
+            # A pair equal to the previous one is a single 1 bit
+            if last and last[0] == (a, b):
+                out.put(1, 1)
+                return
+            if last:
+                out.put(1, 0)
+            out.put(bits_0, a)
+            out.put(bits_1, b)
+            last[:] = [(a, b)]
+
+        def runs(a, b):
+            while a > max_0:
+                pair(max_0, 0)
+                a -= max_0
+            while b > max_1:
+                pair(a, max_1)
+                a = 0
+                b -= max_1
+            if a or b:
+                pair(a, b)
+
+        a = b = 0
+        for row in glyph.rows:
+            for pixel in row:
+                if pixel:
+                    b += 1
+                    continue
+                if b:
+                    runs(a, b)
+                    a = b = 0
+                a += 1
+        runs(a, b)
+        out.put(1, 0)
+        return out.data
+
+    def glyph_record(self, glyph):
+        data = self.encode(glyph, self.bits_0, self.bits_1)
+        if glyph.encoding <= 0xFF:
+            record = bytes([glyph.encoding, len(data) + 2]) + data
+        else:
+            record = bytes([glyph.encoding >> 8, glyph.encoding & 0xFF, len(data) + 3]) + data
+        if len(record) > 255:
+            raise SystemExit("glyph U+%04X is too big for the u8g2 format" % glyph.encoding)
+        return record
+
+
+# Unicode glyphs are grouped into blocks of this many bytes; the lookup
+# table holds one entry per block, so a lookup scans one block at most
+UNICODE_BLOCK_BYTES = 512
+
+
+def build_font(glyphs):
+    glyphs = sorted(glyphs, key=lambda g: g.encoding)
+    enc = Encoder(glyphs)
+    by_code = {g.encoding: g for g in glyphs}
+
+    def top(code):
+        g = by_code.get(code)
+        return g.height + g.y if g else 0
+
+    def bottom(code):
+        g = by_code.get(code)
+        return g.y if g else 0
+
+    ascii_part = bytearray()
+    start_upper = start_lower = None
+    for g in glyphs:
+        if g.encoding > 0xFF:
+            break
+        if start_upper is None and g.encoding >= ord("A"):
+            start_upper = len(ascii_part)
+        if start_lower is None and g.encoding >= ord("a"):
+            start_lower = len(ascii_part)
+        ascii_part += enc.glyph_record(g)
+    if start_upper is None:
+        start_upper = len(ascii_part)
+    if start_lower is None:
+        start_lower = len(ascii_part)
+    ascii_part += b"\0\0"
+
+    blocks = []
+    for g in glyphs:
+        if g.encoding <= 0xFF:
+            continue
+        record = enc.glyph_record(g)
+        if not blocks or len(blocks[-1][1]) + len(record) > UNICODE_BLOCK_BYTES:
+            blocks.append([g.encoding, bytearray()])
+        blocks[-1][0] = g.encoding
+        blocks[-1][1] += record
+    table = bytearray()
+    jump = 4 * max(len(blocks), 1)
+    for i, (last, data) in enumerate(blocks):
+        last = 0xFFFF if i == len(blocks) - 1 else last
+        table += bytes([jump >> 8, jump & 0xFF, last >> 8, last & 0xFF])
+        jump = len(data)
+    if not blocks:
+        table += bytes([0, 4, 0xFF, 0xFF])
+    unicode_part = table + b"".join(data for _, data in blocks) + b"\0\0"
+
+    def s8(v):
+        return v & 0xFF
+
+    start_unicode = len(ascii_part)
+    header = bytes([
+        len(glyphs) & 0xFF, 0, enc.bits_0, enc.bits_1,
+        enc.width_bits, enc.height_bits, enc.x_bits, enc.y_bits, enc.advance_bits,
+        max(g.width for g in glyphs), max(g.height for g in glyphs),
+        s8(min(g.x for g in glyphs)), s8(min(g.y for g in glyphs)),
+        s8(top(ord("A"))), s8(bottom(ord("g"))), s8(top(ord("("))), s8(bottom(ord("("))),
+        start_upper >> 8, start_upper & 0xFF, start_lower >> 8, start_lower & 0xFF,
+        start_unicode >> 8, start_unicode & 0xFF,
+    ])
+    return header + ascii_part + unicode_part
+
+
+def c_string(data):
+    """The font as C string literals with octal escapes, as bdfconv writes it."""
+    lines, line, escaped = [], "", False
+    for byte in data:
+        c = chr(byte)
+        # A digit right after an octal escape would extend it; "?" could
+        # start a trigraph
+        if 32 <= byte < 127 and c not in '"\\?' and not (escaped and c in "01234567"):
+            line += c
+            escaped = False
+        else:
+            line += "\\%o" % byte
+            escaped = True
+        if len(line) >= 88:
+            lines.append('  "%s"' % line)
+            line, escaped = "", False
+    if line:
+        lines.append('  "%s"' % line)
+    return "\n".join(lines)
+
+
+def write_header(path, symbol, source, glyph_count, total, data):
+    guard = "_%s_H" % symbol.upper()
+    with open(path, "w") as out:
+        out.write("#ifndef %s\n#define %s\n\n" % (guard, guard))
+        out.write("#include <stdint.h>\n#include \"hal.h\"\n\n")
+        out.write("// Generated by tools/fontmaker.py from %s: %d of %d glyphs\n" % (source, glyph_count, total))
+        # The font's final 0 byte is the string literal's own NUL
+        out.write("const uint8_t %s[%d] PROGMEM = \n%s;\n\n#endif\n" % (symbol, len(data), c_string(data[:-1])))
+
+
+def fallback_glyph(glyphs):
+    """A hollow box as tall as a capital, for fonts without U+FFFD."""
+    cap = glyphs.get(ord("H"))
+    height = cap.height + cap.y if cap else max(g.height + g.y for g in glyphs.values())
+    width = max(3, height * 3 // 5)
+    rows = [[1] * width] + [[1] + [0] * (width - 2) + [1] for _ in range(height - 2)] + [[1] * width]
+    return Glyph(FALLBACK, width + 2, 1, 0, rows)
+
+
+def code_ranges(codes):
+    """U+XXXX-U+YYYY runs of consecutive code points."""
+    runs = []
+    for code in sorted(codes):
+        if runs and code == runs[-1][1] + 1:
+            runs[-1][1] = code
         else:
-            print("Conversion failed")
+            runs.append([code, code])
+    return ", ".join("U+%04X" % a if a == b else "U+%04X-U+%04X" % (a, b) for a, b in runs)
+
+
+def header_size(path):
+    """Declared size of the first font array in a header, or None."""
+    with open(path, "r", errors="replace") as f:
+        match = re.search(r"uint8_t\s+\w+\[(\d+)\]", f.read())
+    return int(match.group(1)) if match else None
 
-    except Exception as e:
-        print(f"Error: {str(e)}")
-        sys.exit(1)
 
 def main():
-    if len(sys.argv) != 3:
-        print("Usage: python script.py input_font.(ttf|otf) output_font.bdf")
-        sys.exit(1)
-    
-    input_font = sys.argv[1]
-    output_font = sys.argv[2]
-    
-    if not output_font.lower().endswith('.bdf'):
-        output_font += '.bdf'
-    
-    convert_font(input_font, output_font)
+    args = sys.argv[1:]
+    options = {"--name": None, "--chars": "nav", "--text": None, "--size": "22", "--compare": None}
+    positional = []
+    while args:
+        arg = args.pop(0)
+        if arg in options and args:
+            options[arg] = args.pop(0)
+        elif arg.startswith("--"):
+            print(__doc__.strip(), file=sys.stderr)
+            return 2
+        else:
+            positional.append(arg)
+    if len(positional) != 2:
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    source, output = positional
+
+    chars = set()
+    for name in options["--chars"].split(","):
+        if name not in CHAR_SETS:
+            print("unknown character set %s (have %s)" % (name, ", ".join(sorted(CHAR_SETS))), file=sys.stderr)
+            return 2
+        chars |= CHAR_SETS[name]()
+    if options["--text"]:
+        with open(options["--text"], "r", encoding="utf-8") as f:
+            text = f.read()
+        chars |= (set(text) | set(unicodedata.normalize("NFC", text))) - set("\r\n\t")
+
+    if source.lower().endswith((".ttf", ".otf")):
+        # Pillow draws the font's .notdef box if it has no U+FFFD
+        font_name, available = read_ttf(source, int(options["--size"]), chars | {chr(FALLBACK)})
+    else:
+        font_name, available = read_bdf(source)
+    subset = [available[ord(c)] for c in chars if ord(c) in available]
+    missing = sorted(c for c in chars if ord(c) not in available)
+    if not subset:
+        print("no glyphs of the character set in %s" % source, file=sys.stderr)
+        return 1
+    if chr(FALLBACK) not in chars:
+        subset.append(available.get(FALLBACK) or fallback_glyph(available))
+    left_out = set(available) - set(g.encoding for g in subset)
+
+    # Read before writing, the output may replace this very header
+    old = header_size(options["--compare"]) if options["--compare"] else None
+    data = build_font(subset)
+    symbol = options["--name"] or os.path.splitext(os.path.basename(output))[0]
+    write_header(output, symbol, font_name, len(subset), len(available), data)
+
+    full = len(build_font(list(available.values())))
+    print("%s: %d glyphs, %d bytes" % (output, len(subset), len(data)))
+    print("all %d glyphs of %s: %d bytes, saved %d (%.0f%%)"
+          % (len(available), source, full, full - len(data), 100.0 * (full - len(data)) / full))
+    if old:
+        print("%s was %d bytes, saved %d" % (options["--compare"], old, old - len(data)))
+    if left_out:
+        print("left out, drawn as U+FFFD: %d glyphs, %s" % (len(left_out), code_ranges(left_out)))
+    if missing:
+        print("not in the font: %s" % "".join(missing), file=sys.stderr)
+    return 0
+
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    sys.exit(main())
@@ -0,0 +1,10 @@
+# PlatformIO pre-script for env:native: the host build only needs the U8g2
+# C core, so the Arduino C++ wrapper classes are left out.
+Import("env")
+
+
+def skip_arduino_wrapper(node):
+    return None
+
+
+env.AddBuildMiddleware(skip_arduino_wrapper, "*/U8g2/src/*.cpp")
@@ -0,0 +1,53 @@
+"""Turn a Serial log from firmware built with ENABLE_BLE_TRACE into trace files.
+
+    python tools/trace_extract.py serial.log session.trace
+
+Lines that do not start with "TRACE " are ignored. Every reboot starts a new
+trace; when the log holds more than one, they are written as session-1.trace,
+session-2.trace and so on.
+"""
+import os
+import sys
+
+TRACE_MAGIC = b"NVTR"
+
+
+def extract(lines):
+    sessions = []
+    for line in lines:
+        line = line.strip()
+        if not line.startswith("TRACE "):
+            continue
+        try:
+            record = bytes.fromhex(line[6:])
+        except ValueError:
+            print("skipping garbled line: %s" % line[:40], file=sys.stderr)
+            continue
+        if record.startswith(TRACE_MAGIC):
+            sessions.append(bytearray())
+        if sessions:
+            sessions[-1] += record
+    return sessions
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__.strip(), file=sys.stderr)
+        return 2
+    with open(sys.argv[1], "r", errors="replace") as log:
+        sessions = extract(log)
+    if not sessions:
+        print("no trace in %s" % sys.argv[1], file=sys.stderr)
+        return 1
+
+    stem, ext = os.path.splitext(sys.argv[2])
+    for i, session in enumerate(sessions):
+        path = sys.argv[2] if len(sessions) == 1 else "%s-%d%s" % (stem, i + 1, ext)
+        with open(path, "wb") as out:
+            out.write(session)
+        print("%s: %d bytes" % (path, len(session)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())